@@ -0,0 +1,117 @@
+/*
+ * Host benchmark for the effect engine ([env:native]): runs every effect (mode_*) for a number of frames
+ * and prints one CSV line per effect and size with the effect function time (the same frame time profiler that
+ * /json/info "prof" reports on the device) and the memory the effect allocates.
+ * 1D effects run on strips, 2D effects on matrices; by default all sizes below are swept in one run, into one table.
+ * A second table compares Segment::setPixelColor() through the 1D index table with the per-pixel path it replaces.
+ *
+ *   pio run -e native && .pio/build/native/program [frames] [size...]     size: 300 (strip) or 32x32 (matrix)
+ *
+ * Absolute numbers are PC numbers; compare builds (before/after a change) on the same machine.
+ */
+#if defined(WLED_NATIVE) && !defined(PIO_UNIT_TESTING)
+#include <vector>
+#include "wled.h"
+
+static void setupStrip(uint16_t width, uint16_t height) {
+  suspendStripService = true;
+  busses.removeAll();
+  uint8_t pins[] = {23, 18};  // data, clock: a 2-wire SPI bus, so nothing depends on RMT/I2S timing
+  BusConfig bc(TYPE_APA102, pins, 0, width * height, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY);
+  busses.add(bc);
+  strip.panel.clear();
+  strip.isMatrix = (height > 1);
+  if (strip.isMatrix) {
+    WS2812FX::Panel p;
+    p.width = width; p.height = height;
+    strip.panels = 1;
+    strip.panel.push_back(p);
+  }
+  strip.finalizeInit();        // also sets up the matrix
+  strip.makeAutoSegments(true);
+  strip.setBrightness(255, true);
+  bri = 255;
+}
+
+static bool is2D(const char *data) {
+  const char *flags = strrchr(data, ';');
+  return flags && strchr(flags, '2');
+}
+
+static void runEffect(uint8_t id, const char *data, const char *size, unsigned frames) {
+  Segment &seg = strip.getSegment(0);
+  const size_t heapBefore = hostHeapUsed();
+  seg.setMode(id, true);
+  unsigned long t = 1000;
+  for (unsigned f = 0; f < frames + 10; f++) {
+    if (f == 10) strip.profSeg[0].reset(id);  // skip call 0 (allocation, setup) and a few warm-up frames
+    hostSetMillis(t);
+    seg.next_time = 0;                       // render every frame, no matter what the effect asked for
+    strip.service();
+    t += 1000 / 42;
+  }
+  const frametime_stats_t &st = strip.profSeg[0];
+  const size_t heapAfter = hostHeapUsed();
+  char name[48];
+  size_t n = strcspn(data, "@;");
+  snprintf(name, sizeof(name), "%.*s", int(min(n, sizeof(name) - 1)), data);
+  printf("%u,\"%s\",%s,%u,%u,%u,%u,%u,%d\n", id, name, size, st.count, st.avg(), st.percentile(95), st.maxUs,
+         unsigned(seg.dataSize()), int(heapAfter) - int(heapBefore));
+  seg.setMode(FX_MODE_STATIC);
+  seg.resetIfRequired();
+}
+
+// time per virtual pixel (ns) of painting segment 0, with (table) and without (per-pixel arithmetic) the index table
+static float paintNs(Segment &seg, bool table, unsigned reps) {
+  if (table) seg.updatePixelMap(); else seg.deletePixelMap();
+  const int vLen = seg.virtualLength();
+  unsigned long t0 = micros();
+  for (unsigned r = 0; r < reps; r++)
+    for (int i = 0; i < vLen; i++) seg.setPixelColor(i, RGBW32(i, r, i ^ r, 0));
+  return (micros() - t0) * 1000.0f / (float(reps) * vLen);
+}
+
+static void benchPixelMap(uint16_t leds, unsigned reps) {
+  static const uint8_t  groupings[] = {1, 3};
+  static const uint8_t  spacings[]  = {0, 2};
+  static const uint16_t offsets[]   = {0, 137};
+  setupStrip(leds, 1);
+  Segment &seg = strip.getSegment(0);
+  printf("\ngrouping,spacing,mirror,offset,leds,ns_per_pixel_path,ns_table,speedup\n");
+  for (uint8_t grp : groupings) for (uint8_t spc : spacings) for (int mir = 0; mir < 2; mir++) for (uint16_t ofs : offsets) {
+    seg.setUp(0, leds, grp, spc, ofs);
+    seg.mirror = mir;
+    paintNs(seg, false, 2);           // warm up caches
+    float slow = paintNs(seg, false, reps);
+    float fast = paintNs(seg, true, reps);
+    printf("%u,%u,%d,%u,%u,%.1f,%.1f,%.2f\n", grp, spc, mir, ofs, leds, slow, fast, fast > 0 ? slow / fast : 0.0f);
+  }
+  seg.deletePixelMap();
+}
+
+static const char *defaultSizes[] = {"300", "1000", "4000", "16x16", "32x32", "64x64", "128x64"};
+
+int main(int argc, char **argv) {
+  unsigned frames = (argc > 1) ? atoi(argv[1]) : 200;
+  std::vector<const char*> sizes(argv + min(argc, 2), argv + argc);
+  if (sizes.empty()) sizes.assign(std::begin(defaultSizes), std::end(defaultSizes));
+
+  printf("id,effect,size,frames,us_avg,us_p95,us_max,data_bytes,heap_delta\n");
+  for (const char *size : sizes) {
+    unsigned w = 0, h = 1;
+    if (sscanf(size, "%ux%u", &w, &h) < 1 || w == 0 || h == 0 || w * h > MAX_LEDS) {
+      fprintf(stderr, "skipping size %s\n", size);
+      continue;
+    }
+    const bool matrix = (h > 1);
+    setupStrip(w, h);
+    for (uint8_t id = 1; id < strip.getModeCount(); id++) {
+      const char *data = strip.getModeData(id);
+      if (!strncmp(data, "RSVD", 4) || is2D(data) != matrix) continue;
+      runEffect(id, data, size, frames);
+    }
+  }
+  benchPixelMap(1000, frames * 10);
+  return 0;
+}
+#endif
@@ -0,0 +1,86 @@
+// Host implementations of the Arduino core stand-ins declared in this directory
+#include <chrono>
+#include <thread>
+#include <map>
+#include <malloc.h>
+#include "Arduino.h"
+#include "WiFi.h"
+#include "ETH.h"
+#include "ESPmDNS.h"
+#include "Wire.h"
+#include "SPI.h"
+#include "FastLED.h"
+
+// ---- time ----
+static const auto hostEpoch = std::chrono::steady_clock::now();
+static bool hostClockFrozen = false;
+static unsigned long hostFrozenMs = 0;
+
+// micros() always runs, so the frame time profiler measures real work while millis() (effect time) is frozen
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hostEpoch).count();
+}
+unsigned long millis() { return hostClockFrozen ? hostFrozenMs : micros() / 1000UL; }
+void delay(unsigned long ms) {
+  if (hostClockFrozen) hostFrozenMs += ms;
+  else std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+void delayMicroseconds(unsigned int us) { if (!hostClockFrozen) std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+void hostSetMillis(unsigned long ms) { hostClockFrozen = true; hostFrozenMs = ms; }
+void hostRealTime() { hostClockFrozen = false; }
+
+// ---- random: deterministic until randomSeed(), so benchmark and test runs repeat ----
+static uint32_t hostRandState = 0x2545F491;
+static uint32_t hostRand32() { // xorshift32
+  uint32_t x = hostRandState;
+  x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+  return hostRandState = x;
+}
+long random(long howbig) { return howbig > 0 ? long(hostRand32() % uint32_t(howbig)) : 0; }
+long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall); }
+void randomSeed(unsigned long seed) { if (seed) hostRandState = uint32_t(seed); }
+uint32_t esp_random() { return hostRand32(); }
+
+// ---- heap ----
+size_t hostHeapUsed() {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 33))
+  struct mallinfo2 mi = mallinfo2();
+  return mi.uordblks + mi.hblkhd;
+#elif defined(__GLIBC__)
+  struct mallinfo mi = mallinfo();
+  return size_t(unsigned(mi.uordblks)) + size_t(unsigned(mi.hblkhd));
+#else
+  return 0;
+#endif
+}
+
+// ---- UDP loopback: packets "sent" are recorded, packets for a local port are queued until parsePacket() ----
+std::vector<HostUdpPacket> hostUdpSent;
+static std::map<uint16_t, std::deque<HostUdpPacket>> hostUdpInbox;
+
+void hostUdpInject(uint16_t localPort, IPAddress from, const uint8_t *data, size_t len) {
+  hostUdpInbox[localPort].push_back(HostUdpPacket{from, localPort, std::vector<uint8_t>(data, data + len)});
+}
+
+int WiFiUDP::parsePacket() {
+  _in.data.clear(); _inPos = 0;
+  if (!_localPort) return 0;
+  auto it = hostUdpInbox.find(_localPort);
+  if (it == hostUdpInbox.end() || it->second.empty()) return 0;
+  _in = it->second.front();
+  it->second.pop_front();
+  return _in.data.size();
+}
+
+// ---- global objects ----
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+EspClass ESP;
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+WiFiClass WiFi;
+ETHClass ETH;
+MDNSResponder MDNS;
+TwoWire Wire;
+SPIClass SPI;
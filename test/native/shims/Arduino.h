@@ -0,0 +1,176 @@
+#pragma once
+/*
+ * Host (native) stand-in for the Arduino core, just enough to build the WLED effect engine,
+ * the bus layer and the realtime UDP code on a PC. Used by [env:native] and the unit tests in test/.
+ * Time is real (steady clock) unless a test takes over millis() with hostSetMillis().
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <type_traits>
+#include <functional>
+#include <arpa/inet.h>   // htons/htonl, from lwip on the ESP
+#undef INADDR_NONE       // an IPAddress object on Arduino (IPAddress.h)
+
+typedef uint8_t  byte;
+typedef bool     boolean;
+typedef uint16_t word;
+inline uint16_t makeWord(uint16_t w) { return w; }
+inline uint16_t makeWord(uint8_t h, uint8_t l) { return (h << 8) | l; }
+#define word(...) makeWord(__VA_ARGS__)
+
+// ---- attributes and flash access (flash is plain memory on the host) ----
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+#define RAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_ATTR
+#define WORD_ALIGNED_ATTR __attribute__((aligned(4)))
+#define PROGMEM
+#define PGM_P const char *
+#define PGM_VOID_P const void *
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper *>(p))
+#define pgm_read_byte(a)  (*(const uint8_t  *)(a))
+#define pgm_read_word(a)  (*(const uint16_t *)(a))
+// pgm_read_dword() is also used to fetch pointers from PROGMEM tables, which are 64 bit on the host
+template<typename T> inline typename std::enable_if<std::is_pointer<T>::value, T>::type hostPgmReadDword(const T *a) { return *a; }
+template<typename T> inline typename std::enable_if<!std::is_pointer<T>::value, uint32_t>::type hostPgmReadDword(const T *a) { return *(const uint32_t *)a; }
+#define pgm_read_dword(a) hostPgmReadDword(a)
+#define pgm_read_float(a) (*(const float *)(a))
+#define pgm_read_ptr(a)   (*(const void * const *)(a))
+#define pgm_read_byte_near(a) pgm_read_byte(a)
+#define pgm_read_word_near(a) pgm_read_word(a)
+#define memcpy_P      memcpy
+#define memcmp_P      memcmp
+#define strlen_P      strlen
+#define strnlen_P     strnlen
+#define strcpy_P      strcpy
+#define strncpy_P     strncpy
+#define strcat_P      strcat
+#define strncat_P     strncat
+#define strcmp_P      strcmp
+#define strncmp_P     strncmp
+#define strcasecmp_P  strcasecmp
+#define strncasecmp_P strncasecmp
+#define strstr_P      strstr
+#define strchr_P      strchr
+#define sprintf_P     sprintf
+#define snprintf_P    snprintf
+#define vsnprintf_P   vsnprintf
+#define printf_P      printf
+
+// ---- libc extensions of newlib that glibc lacks ----
+#if !defined(__APPLE__) && !defined(__FreeBSD__)
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) { size_t n = (len < size) ? len : size - 1; memcpy(dst, src, n); dst[n] = 0; }
+  return len;
+}
+inline size_t strlcat(char *dst, const char *src, size_t size) {
+  size_t d = strnlen(dst, size);
+  return (d == size) ? size + strlen(src) : d + strlcpy(dst + d, src, size - d);
+}
+inline char *itoa(int v, char *buf, int base) { if (base == 10) sprintf(buf, "%d", v); else if (base == 16) sprintf(buf, "%x", v); else sprintf(buf, "%o", v); return buf; }
+inline char *utoa(unsigned v, char *buf, int base) { if (base == 10) sprintf(buf, "%u", v); else if (base == 16) sprintf(buf, "%x", v); else sprintf(buf, "%o", v); return buf; }
+inline void *reallocf(void *p, size_t size) { void *n = realloc(p, size); if (!n && size) free(p); return n; }
+#endif
+
+// ---- constants and helpers ----
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define OPEN_DRAIN 0x10
+#define OUTPUT_OPEN_DRAIN 0x13
+#define CHANGE 0x03
+#define FALLING 0x02
+#define RISING 0x01
+#define NUM_DIGITAL_PINS 40
+#define A0 36
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define sq(x) ((x)*(x))
+
+#define lowByte(w)  ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+#define bit(b) (1UL << (b))
+#define bitRead(value, b)  (((value) >> (b)) & 0x01)
+#define bitSet(value, b)   ((value) |= (1UL << (b)))
+#define bitClear(value, b) ((value) &= ~(1UL << (b)))
+#define bitWrite(value, b, v) ((v) ? bitSet(value, b) : bitClear(value, b))
+
+// the ESP cores accept mixed argument types here (integer promotion), std::min/max do not
+template<class T, class U> using host_arith_t = typename std::enable_if<std::is_arithmetic<T>::value && std::is_arithmetic<U>::value, typename std::common_type<T, U>::type>::type;
+template<class T, class U> constexpr host_arith_t<T, U> min(const T& a, const U& b) { return (b < a) ? b : a; }
+template<class T, class U> constexpr host_arith_t<T, U> max(const T& a, const U& b) { return (a < b) ? b : a; }
+#define _min(a,b) ((a)<(b)?(a):(b))
+#define _max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  if (in_max == in_min) return out_min;
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// ---- time ----
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+// tests can freeze the clock: after hostSetMillis(t) millis() returns t until hostRealTime(); micros() keeps running
+void hostSetMillis(unsigned long ms);
+void hostRealTime();
+
+// ---- random ----
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+// ---- GPIO (no hardware: reads return 0) ----
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int  digitalRead(uint8_t) { return LOW; }
+inline int  analogRead(uint8_t) { return 0; }
+inline void analogWrite(uint8_t, int) {}
+inline uint16_t analogReadMilliVolts(uint8_t) { return 0; }
+inline void attachInterrupt(uint8_t, void (*)(), int) {}
+inline void detachInterrupt(uint8_t) {}
+#define digitalPinToInterrupt(p) (int(p))
+#define digitalPinHasPWM(p) ((p) < 34)
+#define digitalPinToAnalogChannel(p) ((((p) >= 32) && ((p) <= 39)) ? int((p) - 32) : -1)
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline unsigned long pulseIn(uint8_t, uint8_t, unsigned long = 1000000L) { return 0; }
+inline void tone(uint8_t, unsigned int, unsigned long = 0) {}
+inline void noTone(uint8_t) {}
+
+#include "WString.h"
+#include "Print.h"
+#include "IPAddress.h"
+#include "Esp.h"
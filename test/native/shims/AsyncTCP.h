@@ -0,0 +1,27 @@
+#pragma once
+// Host stand-in: TCP client type, never connects
+#include "Arduino.h"
+class AsyncClient {
+  public:
+    typedef std::function<void(void *, AsyncClient *)> AcConnectHandler;
+    typedef std::function<void(void *, AsyncClient *, void *, size_t)> AcDataHandler;
+    typedef std::function<void(void *, AsyncClient *, int8_t)> AcErrorHandler;
+    bool connect(IPAddress, uint16_t) { return false; }
+    bool connect(const char *, uint16_t) { return false; }
+    bool connected() { return false; }
+    bool connecting() { return false; }
+    bool disconnected() { return true; }
+    void close(bool = false) {}
+    size_t add(const char *, size_t, uint8_t = 0) { return 0; }
+    bool send() { return false; }
+    size_t write(const char *) { return 0; }
+    size_t write(const char *, size_t, uint8_t = 0) { return 0; }
+    bool canSend() { return false; }
+    size_t space() { return 0; }
+    void onConnect(AcConnectHandler, void * = nullptr) {}
+    void onDisconnect(AcConnectHandler, void * = nullptr) {}
+    void onData(AcDataHandler, void * = nullptr) {}
+    void onError(AcErrorHandler, void * = nullptr) {}
+    void setNoDelay(bool) {}
+    IPAddress remoteIP() { return IPAddress(); }
+};
@@ -0,0 +1,39 @@
+#pragma once
+// Host stand-in for AsyncUDP (E1.31/DDP/Art-Net receiver); listens on nothing
+#include "WiFi.h"
+
+class AsyncUDPPacket {
+  public:
+    AsyncUDPPacket(const uint8_t *data = nullptr, size_t len = 0, IPAddress remote = IPAddress(), uint16_t localPort = 0, bool broadcast = false, bool multicast = false)
+    : _data(data), _len(len), _remote(remote), _localPort(localPort), _broadcast(broadcast), _multicast(multicast) {}
+    uint8_t *data() { return const_cast<uint8_t *>(_data); }
+    size_t length() { return _len; }
+    IPAddress remoteIP() { return _remote; }
+    uint16_t remotePort() { return 0; }
+    uint16_t localPort() { return _localPort; }
+    IPAddress localIP() { return WiFi.localIP(); }
+    bool isBroadcast() { return _broadcast; }
+    bool isMulticast() { return _multicast; }
+  private:
+    const uint8_t *_data;
+    size_t _len;
+    IPAddress _remote;
+    uint16_t _localPort;
+    bool _broadcast, _multicast;
+};
+typedef std::function<void(AsyncUDPPacket &packet)> AuPacketHandlerFunction;
+
+class AsyncUDP {
+  public:
+    void onPacket(AuPacketHandlerFunction cb) { _cb = cb; }
+    bool listen(uint16_t) { return true; }
+    bool listen(const IPAddress &, uint16_t) { return true; }
+    bool listenMulticast(const IPAddress &, uint16_t, uint8_t = 1) { return true; }
+    void close() {}
+    size_t writeTo(const uint8_t *, size_t len, const IPAddress &, uint16_t) { return len; }
+    size_t broadcastTo(uint8_t *, size_t len, uint16_t) { return len; }
+    // host only: deliver a packet as if it had arrived
+    void hostReceive(AsyncUDPPacket &p) { if (_cb) _cb(p); }
+  private:
+    AuPacketHandlerFunction _cb;
+};
@@ -0,0 +1,12 @@
+#pragma once
+// Host stand-in: captive portal DNS does nothing on the host
+#include "Arduino.h"
+enum class DNSReplyCode { NoError = 0, ServerFailure = 2, NonExistentDomain = 3 };
+class DNSServer {
+  public:
+    bool start(uint16_t, const String &, const IPAddress &) { return true; }
+    void stop() {}
+    void processNextRequest() {}
+    void setErrorReplyCode(const DNSReplyCode &) {}
+    void setTTL(uint32_t) {}
+};
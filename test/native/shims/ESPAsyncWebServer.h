@@ -0,0 +1,211 @@
+#pragma once
+// Host stand-in for (the Aircoookie fork of) ESPAsyncWebServer: the types WLED's headers and
+// globals need. There is no HTTP server on the host; handlers are stored and never called.
+#include <vector>
+#include "Arduino.h"
+#include "FS.h"
+#include "AsyncTCP.h"
+
+#define SPIFFS_EDITOR_AIRCOOOKIE
+
+typedef enum { HTTP_GET = 0b00000001, HTTP_POST = 0b00000010, HTTP_DELETE = 0b00000100, HTTP_PUT = 0b00001000,
+               HTTP_PATCH = 0b00010000, HTTP_HEAD = 0b00100000, HTTP_OPTIONS = 0b01000000, HTTP_ANY = 0b01111111 } WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebParameter {
+  public:
+    AsyncWebParameter(const String &name, const String &value, bool form = false, bool file = false, size_t size = 0)
+    : _name(name), _value(value), _size(size), _isForm(form), _isFile(file) {}
+    const String &name() const { return _name; }
+    const String &value() const { return _value; }
+    size_t size() const { return _size; }
+    bool isPost() const { return _isForm; }
+    bool isFile() const { return _isFile; }
+  private:
+    String _name, _value;
+    size_t _size;
+    bool _isForm, _isFile;
+};
+
+class AsyncWebHeader {
+  public:
+    AsyncWebHeader(const String &name, const String &value) : _name(name), _value(value) {}
+    const String &name() const { return _name; }
+    const String &value() const { return _value; }
+  private:
+    String _name, _value;
+};
+
+class AsyncWebServerResponse {
+  public:
+    virtual ~AsyncWebServerResponse() {}
+    void setCode(int code) { _code = code; }
+    void setContentLength(size_t len) { _contentLength = len; }
+    void setContentType(const String &type) { _contentType = type; }
+    void addHeader(const String &, const String &) {}
+    int code() const { return _code; }
+  protected:
+    int _code = 0;
+    String _contentType;
+    size_t _contentLength = 0;
+    size_t _sentLength = 0;
+};
+
+class AsyncAbstractResponse : public AsyncWebServerResponse {
+  public:
+    virtual bool _sourceValid() const { return false; }
+    virtual size_t _fillBuffer(uint8_t *, size_t) { return 0; }
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+  public:
+    size_t write(uint8_t c) override { _content += char(c); return 1; }
+    using Print::write;
+  private:
+    String _content;
+};
+
+class AsyncWebServerRequest;
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+typedef std::function<String(const String &)> AwsTemplateProcessor;
+
+class AsyncWebServerRequest {
+  public:
+    void *_tempObject = nullptr;
+    WebRequestMethodComposite method() const { return _method; }
+    const String &url() const { return _url; }
+    const String &host() const { return _host; }
+    IPAddress remoteIP() { return IPAddress(); }
+    AsyncClient *client() { return nullptr; }
+    bool hasParam(const String &name, bool post = false, bool file = false) const { return getParam(name, post, file) != nullptr; }
+    AsyncWebParameter *getParam(const String &, bool = false, bool = false) const { return nullptr; }
+    AsyncWebParameter *getParam(size_t) const { return nullptr; }
+    size_t params() const { return 0; }
+    bool hasArg(const char *) const { return false; }
+    bool hasArg(const __FlashStringHelper *) const { return false; }
+    bool hasArg(const String &) const { return false; }
+    const String &arg(const String &) const { return _empty; }
+    bool hasHeader(const String &) const { return false; }
+    AsyncWebHeader *getHeader(const String &) const { return nullptr; }
+    void addInterestingHeader(const String &) {}
+    void send(AsyncWebServerResponse *response) { delete response; }
+    void send(int code, const String & = String(), const String & = String()) { (void)code; }
+    void send(FS &, const String &, const String & = String(), bool = false, AwsTemplateProcessor = nullptr) {}
+    void send_P(int, const String &, const uint8_t *, size_t, AwsTemplateProcessor = nullptr) {}
+    void send_P(int, const String &, const char *, AwsTemplateProcessor = nullptr) {}
+    void redirect(const String &) {}
+    AsyncWebServerResponse *beginResponse(int code, const String & = String(), const String & = String()) { auto r = new AsyncWebServerResponse(); r->setCode(code); return r; }
+    AsyncWebServerResponse *beginResponse(FS &, const String &, const String & = String(), bool = false, AwsTemplateProcessor = nullptr) { return new AsyncWebServerResponse(); }
+    AsyncWebServerResponse *beginResponse_P(int code, const String &, const uint8_t *, size_t, AwsTemplateProcessor = nullptr) { auto r = new AsyncWebServerResponse(); r->setCode(code); return r; }
+    AsyncWebServerResponse *beginResponse_P(int code, const String &, const char *, AwsTemplateProcessor = nullptr) { auto r = new AsyncWebServerResponse(); r->setCode(code); return r; }
+    AsyncResponseStream *beginResponseStream(const String &, size_t = 1460) { return new AsyncResponseStream(); }
+  private:
+    WebRequestMethodComposite _method = HTTP_GET;
+    String _url, _host, _empty;
+};
+
+class AsyncWebHandler {
+  public:
+    virtual ~AsyncWebHandler() {}
+    virtual bool canHandle(AsyncWebServerRequest *) { return false; }
+    virtual void handleRequest(AsyncWebServerRequest *) {}
+    virtual void handleUpload(AsyncWebServerRequest *, const String &, size_t, uint8_t *, size_t, bool) {}
+    virtual void handleBody(AsyncWebServerRequest *, uint8_t *, size_t, size_t, size_t) {}
+    virtual bool isRequestHandlerTrivial() { return true; }
+    AsyncWebHandler &setFilter(std::function<bool(AsyncWebServerRequest *)>) { return *this; }
+    AsyncWebHandler &setAuthentication(const char *, const char *) { return *this; }
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler {};
+class AsyncStaticWebHandler : public AsyncWebHandler {
+  public:
+    AsyncStaticWebHandler &setDefaultFile(const char *) { return *this; }
+    AsyncStaticWebHandler &setCacheControl(const char *) { return *this; }
+};
+
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef struct { uint8_t message_opcode; uint32_t num; uint8_t final; uint8_t masked; uint8_t opcode; uint64_t len; uint8_t mask[4]; uint64_t index; } AwsFrameInfo;
+typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus;
+
+class AsyncWebSocketMessageBuffer {
+  public:
+    AsyncWebSocketMessageBuffer(size_t size = 0) : _data(size + 1, 0) {}
+    uint8_t *get() { return _data.data(); }
+    size_t length() const { return _data.size() - 1; }
+  private:
+    std::vector<uint8_t> _data;
+};
+
+class AsyncWebSocket;
+class AsyncWebSocketClient {
+  public:
+    uint32_t id() const { return 0; }
+    AwsClientStatus status() const { return WS_DISCONNECTED; }
+    IPAddress remoteIP() { return IPAddress(); }
+    bool queueIsFull() const { return false; }
+    size_t queueLen() const { return 0; }
+    void text(const char *, size_t = 0) {}
+    void text(const String &) {}
+    void text(AsyncWebSocketMessageBuffer *b) { delete b; }
+    void binary(const uint8_t *, size_t) {}
+    void binary(const char *, size_t) {}
+    void binary(AsyncWebSocketMessageBuffer *b) { delete b; }
+    void close(uint16_t = 0, const char * = nullptr) {}
+    void ping(const uint8_t * = nullptr, size_t = 0) {}
+    void setCloseClientOnQueueFull(bool) {}
+};
+typedef std::function<void(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+  public:
+    AsyncWebSocket(const String &url) : _url(url) {}
+    void onEvent(AwsEventHandler handler) { _handler = handler; }
+    size_t count() const { return 0; }
+    AsyncWebSocketClient *client(uint32_t) { return nullptr; }
+    bool hasClient(uint32_t) { return false; }
+    void cleanupClients(uint16_t = 4) {}
+    void closeAll(uint16_t = 0, const char * = nullptr) {}
+    bool availableForWriteAll() { return true; }
+    bool availableForWrite(uint32_t) { return true; }
+    void textAll(const char *, size_t = 0) {}
+    void textAll(const String &) {}
+    void textAll(AsyncWebSocketMessageBuffer *b) { delete b; }
+    void binaryAll(const uint8_t *, size_t) {}
+    void binaryAll(AsyncWebSocketMessageBuffer *b) { delete b; }
+    AsyncWebSocketMessageBuffer *makeBuffer(size_t size = 0) { return new AsyncWebSocketMessageBuffer(size); }
+    const std::vector<AsyncWebSocketClient *> &getClients() const { return _clients; }
+  private:
+    String _url;
+    AwsEventHandler _handler;
+    std::vector<AsyncWebSocketClient *> _clients;
+};
+
+class AsyncWebServer {
+  public:
+    AsyncWebServer(uint16_t) {}
+    void begin() {}
+    void end() {}
+    AsyncWebHandler &addHandler(AsyncWebHandler *handler) { return *handler; }
+    bool removeHandler(AsyncWebHandler *) { return true; }
+    AsyncCallbackWebHandler &on(const char *, ArRequestHandlerFunction) { return _cb; }
+    AsyncCallbackWebHandler &on(const char *, WebRequestMethodComposite, ArRequestHandlerFunction) { return _cb; }
+    AsyncCallbackWebHandler &on(const char *, WebRequestMethodComposite, ArRequestHandlerFunction, ArUploadHandlerFunction) { return _cb; }
+    AsyncCallbackWebHandler &on(const char *, WebRequestMethodComposite, ArRequestHandlerFunction, ArUploadHandlerFunction, ArBodyHandlerFunction) { return _cb; }
+    AsyncStaticWebHandler &serveStatic(const char *, FS &, const char *, const char * = nullptr) { return _st; }
+    void onNotFound(ArRequestHandlerFunction) {}
+    void onFileUpload(ArUploadHandlerFunction) {}
+    void onRequestBody(ArBodyHandlerFunction) {}
+    void reset() {}
+  private:
+    AsyncCallbackWebHandler _cb;
+    AsyncStaticWebHandler _st;
+};
+
+class DefaultHeaders {
+  public:
+    void addHeader(const String &, const String &) {}
+    static DefaultHeaders &Instance() { static DefaultHeaders h; return h; }
+};
@@ -0,0 +1,15 @@
+#pragma once
+// Host stand-in: mDNS does nothing on the host
+#include "Arduino.h"
+class MDNSResponder {
+  public:
+    bool begin(const char *) { return true; }
+    void end() {}
+    bool addService(const char *, const char *, uint16_t) { return true; }
+    void addServiceTxt(const char *, const char *, const char *, const char *) {}
+    int queryService(const char *, const char *) { return 0; }
+    IPAddress IP(int) { return IPAddress(); }
+    uint16_t port(int) { return 0; }
+    String hostname(int) { return String(); }
+};
+extern MDNSResponder MDNS;
@@ -0,0 +1,39 @@
+#pragma once
+// Host stand-in for the ESP object. Heap figures are modelled on a 320KB ESP32 heap;
+// "used" is what this process has allocated from malloc (see hostHeapUsed()).
+#include <stdint.h>
+#include <stddef.h>
+#include "WString.h"
+
+#define HOST_HEAP_SIZE (320*1024)
+
+size_t hostHeapUsed();  // bytes currently allocated by the process (glibc mallinfo2)
+
+class EspClass {
+  public:
+    uint32_t getFreeHeap() { size_t used = hostHeapUsed(); return used < HOST_HEAP_SIZE ? HOST_HEAP_SIZE - used : 0; }
+    uint32_t getHeapSize() { return HOST_HEAP_SIZE; }
+    uint32_t getMaxAllocHeap() { return getFreeHeap(); }
+    uint32_t getMinFreeHeap() { return getFreeHeap(); }
+    uint32_t getMaxFreeBlockSize() { return getFreeHeap(); }
+    uint8_t  getHeapFragmentation() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    uint32_t getPsramSize() { return 0; }
+    uint32_t getFreeSketchSpace() { return 1024*1024; }
+    uint32_t getSketchSize() { return 1024*1024; }
+    uint32_t getFlashChipSize() { return 4*1024*1024; }
+    uint32_t getFlashChipSpeed() { return 80000000; }
+    uint32_t getFlashChipMode() { return 0; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint8_t  getChipRevision() { return 3; }
+    uint8_t  getChipCores() { return 2; }
+    const char *getChipModel() { return "native"; }
+    const char *getSdkVersion() { return "native"; }
+    uint32_t getChipId() { return 0x00C0FFEE; }
+    uint64_t getEfuseMac() { return 0x0000EEFFC0000000ULL; }
+    uint32_t getCycleCount() { return 0; }
+    String   getResetReason() { return String("native"); }
+    void     restart() {}
+    void     wdtFeed() {}
+};
+extern EspClass ESP;
@@ -0,0 +1,130 @@
+// Host implementation of the Arduino FS API (see FS.h): plain files below a root directory
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "FS.h"
+#include "LittleFS.h"
+
+static std::string hostRoot = "native_fs";
+
+void hostFsRoot(const char *dir) { hostRoot = dir ? dir : "native_fs"; ::mkdir(hostRoot.c_str(), 0755); }
+
+const char *hostFsPath(const char *path) {
+  static std::string p;
+  p = hostRoot;
+  if (!path || path[0] != '/') p += '/';
+  if (path) p += path;
+  return p.c_str();
+}
+
+namespace fs {
+
+class FileImpl {
+  public:
+    FILE *f = nullptr;
+    std::string path;             // filesystem path ("/cfg.json")
+    bool dir = false;
+    std::vector<std::string> entries; // directory listing
+    size_t next = 0;
+    ~FileImpl() { if (f) fclose(f); }
+};
+
+size_t File::write(uint8_t c) { return (_p && _p->f) ? fwrite(&c, 1, 1, _p->f) : 0; }
+size_t File::write(const uint8_t *buf, size_t size) { return (_p && _p->f) ? fwrite(buf, 1, size, _p->f) : 0; }
+int File::available() {
+  if (!_p || !_p->f) return 0;
+  long s = size(), pos = ftell(_p->f);
+  return (pos >= 0 && s > pos) ? int(s - pos) : 0;
+}
+int File::read() { return (_p && _p->f) ? fgetc(_p->f) : -1; }
+int File::peek() {
+  if (!_p || !_p->f) return -1;
+  int c = fgetc(_p->f);
+  if (c >= 0) ungetc(c, _p->f);
+  return c;
+}
+void File::flush() { if (_p && _p->f) fflush(_p->f); }
+size_t File::read(uint8_t *buf, size_t size) { return (_p && _p->f) ? fread(buf, 1, size, _p->f) : 0; }
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_p || !_p->f) return false;
+  return fseek(_p->f, long(pos), mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END)) == 0;
+}
+size_t File::position() const { return (_p && _p->f) ? size_t(ftell(_p->f)) : 0; }
+size_t File::size() const {
+  if (!_p || !_p->f) return 0;
+  fflush(_p->f);
+  struct stat st;
+  return (fstat(fileno(_p->f), &st) == 0) ? size_t(st.st_size) : 0;
+}
+void File::close() { _p.reset(); }
+File::operator bool() const { return _p && (_p->f || _p->dir); }
+time_t File::getLastWrite() {
+  if (!_p) return 0;
+  struct stat st;
+  return (stat(hostFsPath(_p->path.c_str()), &st) == 0) ? st.st_mtime : 0;
+}
+const char *File::path() const { return _p ? _p->path.c_str() : ""; }
+const char *File::name() const {
+  if (!_p) return "";
+  size_t slash = _p->path.rfind('/');
+  return _p->path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+}
+bool File::isDirectory() const { return _p && _p->dir; }
+File File::openNextFile(const char *mode) {
+  if (!_p || !_p->dir || _p->next >= _p->entries.size()) return File();
+  std::string child = _p->path;
+  if (child.empty() || child.back() != '/') child += '/';
+  child += _p->entries[_p->next++];
+  return LittleFS.open(child.c_str(), mode);
+}
+void File::rewindDirectory() { if (_p) _p->next = 0; }
+
+bool FS::begin(bool) { ::mkdir(hostRoot.c_str(), 0755); return true; }
+
+File FS::open(const char *path, const char *mode, bool) {
+  if (!path) return File();
+  auto impl = std::make_shared<FileImpl>();
+  impl->path = path;
+  const char *hp = hostFsPath(path);
+  struct stat st;
+  if (stat(hp, &st) == 0 && S_ISDIR(st.st_mode)) {
+    impl->dir = true;
+    if (DIR *d = opendir(hp)) {
+      while (struct dirent *e = readdir(d)) if (e->d_name[0] != '.') impl->entries.push_back(e->d_name);
+      closedir(d);
+    }
+    std::sort(impl->entries.begin(), impl->entries.end());
+    return File(impl);
+  }
+  std::string m = mode ? mode : "r";
+  if (m == "r") m = "rb"; else if (m == "w") m = "wb"; else if (m == "a") m = "ab";
+  impl->f = fopen(hp, m.c_str());
+  return impl->f ? File(impl) : File();
+}
+bool FS::exists(const char *path) { struct stat st; return path && stat(hostFsPath(path), &st) == 0; }
+bool FS::remove(const char *path) { return path && ::unlink(hostFsPath(path)) == 0; }
+bool FS::rename(const char *from, const char *to) {
+  if (!from || !to) return false;
+  std::string f = hostFsPath(from);
+  return ::rename(f.c_str(), hostFsPath(to)) == 0;
+}
+bool FS::mkdir(const char *path) { return path && ::mkdir(hostFsPath(path), 0755) == 0; }
+bool FS::rmdir(const char *path) { return path && ::rmdir(hostFsPath(path)) == 0; }
+bool FS::format() {
+  File root = open("/");
+  while (File f = root.openNextFile()) { std::string p = f.path(); f.close(); remove(p.c_str()); }
+  return true;
+}
+size_t FS::usedBytes() {
+  size_t used = 0;
+  File root = open("/");
+  while (File f = root.openNextFile()) used += f.size();
+  return used;
+}
+
+} // namespace fs
+
+fs::FS LittleFS;
@@ -0,0 +1,76 @@
+#pragma once
+// Host stand-in for the Arduino FS API. Paths map into a directory on the PC
+// (default ./native_fs, override with hostFsRoot()), so ledmaps and presets can be real files.
+#include <memory>
+#include "Arduino.h"
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+void hostFsRoot(const char *dir);
+const char *hostFsPath(const char *path);   // host path for a filesystem path (static buffer)
+
+struct FSInfo { size_t totalBytes; size_t usedBytes; size_t blockSize; size_t pageSize; size_t maxOpenFiles; size_t maxPathLength; };
+
+namespace fs {
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class FileImpl;
+class File : public Stream {
+  public:
+    File() {}
+    File(std::shared_ptr<FileImpl> p) : _p(p) {}
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override;
+    size_t read(uint8_t *buf, size_t size);
+    size_t readBytes(char *buf, size_t len) override { return read((uint8_t *)buf, len); }
+    bool seek(uint32_t pos, SeekMode mode);
+    bool seek(uint32_t pos) { return seek(pos, SeekSet); }
+    size_t position() const;
+    size_t size() const;
+    void close();
+    operator bool() const;
+    time_t getLastWrite();
+    const char *path() const;
+    const char *name() const;
+    bool isDirectory() const;
+    File openNextFile(const char *mode = FILE_READ);
+    void rewindDirectory();
+  private:
+    std::shared_ptr<FileImpl> _p;
+};
+
+class FS {
+  public:
+    bool begin(bool = false);   // creates the root directory
+    void end() {}
+    bool format();
+    File open(const char *path, const char *mode = FILE_READ, bool create = false);
+    File open(const String &path, const char *mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char *path);
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool remove(const char *path);
+    bool remove(const String &path) { return remove(path.c_str()); }
+    bool rename(const char *from, const char *to);
+    bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+    bool mkdir(const char *path);
+    bool mkdir(const String &path) { return mkdir(path.c_str()); }
+    bool rmdir(const char *path);
+    size_t totalBytes() { return 1024*1024; }
+    size_t usedBytes();
+    bool info(FSInfo &i) { i = FSInfo{totalBytes(), usedBytes(), 4096, 256, 16, 32}; return true; }
+};
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
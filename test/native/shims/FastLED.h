@@ -0,0 +1,402 @@
+#pragma once
+/*
+ * Host stand-in for the parts of FastLED 3.6 that WLED uses: lib8tion math, CRGB/CHSV,
+ * 16-entry palettes, colour utilities and Perlin noise. Integer formulas follow FastLED's
+ * portable C implementations, so effects produce the same kind of output as on the device.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "Arduino.h"
+
+typedef uint8_t  fract8;
+typedef uint16_t fract16;
+typedef int8_t   sfract7;
+typedef int16_t  sfract15;
+typedef uint16_t accum88;
+typedef int16_t  saccum78;
+typedef uint32_t accum1616;
+typedef int32_t  saccum1516;
+typedef uint16_t accum124;
+typedef int32_t  saccum114;
+
+#define FASTLED_SCALE8_FIXED 1
+#define FL_PROGMEM
+#define FL_PGM_READ_DWORD_NEAR(x) (*((const uint32_t *)(x)))
+#define GET_MILLIS millis
+#define LIB8STATIC static inline
+#define LIB8STATIC_ALWAYS_INLINE static inline
+
+// ---- lib8tion: 8/16 bit math ----
+LIB8STATIC_ALWAYS_INLINE uint8_t qadd8(uint8_t i, uint8_t j) { unsigned t = i + j; return t > 255 ? 255 : t; }
+LIB8STATIC_ALWAYS_INLINE int8_t  qadd7(int8_t i, int8_t j) { int t = i + j; return t > 127 ? 127 : (t < -128 ? -128 : t); }
+LIB8STATIC_ALWAYS_INLINE uint8_t qsub8(uint8_t i, uint8_t j) { int t = i - j; return t < 0 ? 0 : t; }
+LIB8STATIC_ALWAYS_INLINE uint8_t add8(uint8_t i, uint8_t j) { return i + j; }
+LIB8STATIC_ALWAYS_INLINE uint16_t add8to16(uint8_t i, uint16_t j) { return i + j; }
+LIB8STATIC_ALWAYS_INLINE uint8_t sub8(uint8_t i, uint8_t j) { return i - j; }
+LIB8STATIC_ALWAYS_INLINE uint8_t avg8(uint8_t i, uint8_t j) { return (i + j) >> 1; }
+LIB8STATIC_ALWAYS_INLINE uint16_t avg16(uint16_t i, uint16_t j) { return (uint32_t(i) + j) >> 1; }
+LIB8STATIC_ALWAYS_INLINE int8_t  avg7(int8_t i, int8_t j) { return (i >> 1) + (j >> 1) + (i & 0x1); }
+LIB8STATIC_ALWAYS_INLINE int16_t avg15(int16_t i, int16_t j) { return (i >> 1) + (j >> 1) + (i & 0x1); }
+LIB8STATIC_ALWAYS_INLINE uint8_t mod8(uint8_t a, uint8_t m) { while (a >= m) a -= m; return a; }
+LIB8STATIC_ALWAYS_INLINE uint8_t addmod8(uint8_t a, uint8_t b, uint8_t m) { a += b; while (a >= m) a -= m; return a; }
+LIB8STATIC_ALWAYS_INLINE uint8_t submod8(uint8_t a, uint8_t b, uint8_t m) { a -= b; while (a >= m) a -= m; return a; }
+LIB8STATIC_ALWAYS_INLINE uint8_t mul8(uint8_t i, uint8_t j) { return (i * j) & 0xFF; }
+LIB8STATIC_ALWAYS_INLINE uint8_t qmul8(uint8_t i, uint8_t j) { unsigned p = i * j; return p > 255 ? 255 : p; }
+LIB8STATIC_ALWAYS_INLINE int8_t  abs8(int8_t i) { return i < 0 ? -i : i; }
+LIB8STATIC_ALWAYS_INLINE uint8_t scale8(uint8_t i, fract8 scale) { return (uint16_t(i) * (1 + uint16_t(scale))) >> 8; }
+LIB8STATIC_ALWAYS_INLINE uint8_t scale8_LEAVING_R1_DIRTY(uint8_t i, fract8 scale) { return scale8(i, scale); }
+LIB8STATIC_ALWAYS_INLINE uint8_t scale8_video(uint8_t i, fract8 scale) { return ((int(i) * int(scale)) >> 8) + ((i && scale) ? 1 : 0); }
+LIB8STATIC_ALWAYS_INLINE uint8_t scale8_video_LEAVING_R1_DIRTY(uint8_t i, fract8 scale) { return scale8_video(i, scale); }
+LIB8STATIC_ALWAYS_INLINE void cleanup_R1() {}
+LIB8STATIC_ALWAYS_INLINE uint16_t scale16by8(uint16_t i, fract8 scale) { return (uint32_t(i) * (1 + uint32_t(scale))) >> 8; }
+LIB8STATIC_ALWAYS_INLINE uint16_t scale16(uint16_t i, fract16 scale) { return (uint32_t(i) * (1 + uint32_t(scale))) >> 16; }
+LIB8STATIC void nscale8x3(uint8_t &r, uint8_t &g, uint8_t &b, fract8 scale) { r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale); }
+LIB8STATIC void nscale8x3_video(uint8_t &r, uint8_t &g, uint8_t &b, fract8 scale) { r = scale8_video(r, scale); g = scale8_video(g, scale); b = scale8_video(b, scale); }
+LIB8STATIC void nscale8x2(uint8_t &i, uint8_t &j, fract8 scale) { i = scale8(i, scale); j = scale8(j, scale); }
+LIB8STATIC uint8_t dim8_raw(uint8_t x) { return scale8(x, x); }
+LIB8STATIC uint8_t dim8_video(uint8_t x) { return scale8_video(x, x); }
+LIB8STATIC uint8_t dim8_lin(uint8_t x) { if (x & 0x80) x = scale8(x, x); else { x += 1; x /= 2; } return x; }
+LIB8STATIC uint8_t brighten8_raw(uint8_t x) { uint8_t ix = 255 - x; return 255 - scale8(ix, ix); }
+LIB8STATIC uint8_t brighten8_video(uint8_t x) { uint8_t ix = 255 - x; return 255 - scale8_video(ix, ix); }
+LIB8STATIC uint8_t brighten8_lin(uint8_t x) { uint8_t ix = 255 - x; if (ix & 0x80) ix = scale8(ix, ix); else { ix += 1; ix /= 2; } return 255 - ix; }
+LIB8STATIC uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+  if (b > a) return a + scale8(b - a, frac);
+  return a - scale8(a - b, frac);
+}
+LIB8STATIC uint16_t lerp16by16(uint16_t a, uint16_t b, fract16 frac) {
+  if (b > a) return a + scale16(b - a, frac);
+  return a - scale16(a - b, frac);
+}
+LIB8STATIC uint16_t lerp16by8(uint16_t a, uint16_t b, fract8 frac) {
+  if (b > a) return a + scale16by8(b - a, frac);
+  return a - scale16by8(a - b, frac);
+}
+LIB8STATIC int16_t lerp15by8(int16_t a, int16_t b, fract8 frac) {
+  if (b > a) return a + scale16by8(b - a, frac);
+  return a - scale16by8(a - b, frac);
+}
+LIB8STATIC int16_t lerp15by16(int16_t a, int16_t b, fract16 frac) {
+  if (b > a) return a + scale16(b - a, frac);
+  return a - scale16(a - b, frac);
+}
+LIB8STATIC uint8_t map8(uint8_t in, uint8_t rangeStart, uint8_t rangeEnd) { return rangeStart + scale8(in, rangeEnd - rangeStart); }
+LIB8STATIC uint8_t sqrt16(uint16_t x) {
+  if (x <= 1) return x;
+  uint8_t low = 1, hi, mid;
+  if (x > 7904) hi = 255; else hi = (x >> 5) + 8;
+  do {
+    mid = (low + hi) >> 1;
+    if (uint16_t(mid * mid) > x) hi = mid - 1; else { if (mid == 255) return 255; low = mid + 1; }
+  } while (hi >= low);
+  return low - 1;
+}
+LIB8STATIC uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+  uint16_t partial = (a << 8) | b;
+  partial += (b * amountOfB);
+  partial -= (a * amountOfB);
+  return partial >> 8;
+}
+
+// ---- trig ----
+LIB8STATIC int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3;
+  if (theta & 0x4000) offset = 2047 - offset;
+  uint8_t section = offset / 256;
+  uint16_t b = base[section];
+  uint8_t m = slope[section];
+  uint8_t secoffset8 = uint8_t(offset) / 2;
+  uint16_t mx = m * secoffset8;
+  int16_t y = mx + b;
+  if (theta & 0x8000) y = -y;
+  return y;
+}
+LIB8STATIC int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+LIB8STATIC uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+  uint8_t offset = theta;
+  if (theta & 0x40) offset = 255 - offset;
+  offset &= 0x3F;
+  uint8_t secoffset = offset & 0x0F;
+  if (theta & 0x40) ++secoffset;
+  uint8_t section = offset >> 4;
+  uint8_t s2 = section * 2;
+  uint8_t b = b_m16_interleave[s2];
+  uint8_t m16 = b_m16_interleave[s2 + 1];
+  uint8_t mx = (m16 * secoffset) >> 4;
+  int8_t y = mx + b;
+  if (theta & 0x80) y = -y;
+  y += 128;
+  return y;
+}
+LIB8STATIC uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+
+// ---- waves and easing ----
+LIB8STATIC uint8_t ease8InOutQuad(uint8_t i) { uint8_t j = i; if (j & 0x80) j = 255 - j; uint8_t jj = scale8(j, j); uint8_t jj2 = jj << 1; if (i & 0x80) jj2 = 255 - jj2; return jj2; }
+LIB8STATIC uint16_t ease16InOutQuad(uint16_t i) { uint16_t j = i; if (j & 0x8000) j = 65535 - j; uint16_t jj = scale16(j, j); uint16_t jj2 = jj << 1; if (i & 0x8000) jj2 = 65535 - jj2; return jj2; }
+LIB8STATIC fract8 ease8InOutCubic(fract8 i) {
+  uint8_t ii = scale8_LEAVING_R1_DIRTY(i, i);
+  uint8_t iii = scale8_LEAVING_R1_DIRTY(ii, i);
+  uint16_t r1 = (3 * uint16_t(ii)) - (2 * uint16_t(iii));
+  uint8_t result = r1;
+  if (r1 & 0x100) result = 255;
+  return result;
+}
+LIB8STATIC fract8 ease8InOutApprox(fract8 i) {
+  if (i < 64) i /= 2;
+  else if (i > (255 - 64)) { i = 255 - i; i /= 2; i = 255 - i; }
+  else { i -= 64; i += (i / 2); i += 32; }
+  return i;
+}
+LIB8STATIC uint8_t triwave8(uint8_t in) { if (in & 0x80) in = 255 - in; return in << 1; }
+LIB8STATIC uint8_t quadwave8(uint8_t in) { return ease8InOutQuad(triwave8(in)); }
+LIB8STATIC uint8_t cubicwave8(uint8_t in) { return ease8InOutCubic(triwave8(in)); }
+LIB8STATIC uint8_t squarewave8(uint8_t in, uint8_t pulsewidth = 128) { return (in < pulsewidth || pulsewidth == 255) ? 255 : 0; }
+
+// ---- random ----
+#define FASTLED_RAND16_2053  ((uint16_t)(2053))
+#define FASTLED_RAND16_13849 ((uint16_t)(13849))
+extern uint16_t rand16seed;
+#define APPLY_FASTLED_RAND16_2053(x) (x * FASTLED_RAND16_2053)
+LIB8STATIC uint8_t random8() { rand16seed = (rand16seed * FASTLED_RAND16_2053) + FASTLED_RAND16_13849; return uint8_t(uint8_t(rand16seed & 0xFF) + uint8_t(rand16seed >> 8)); }
+LIB8STATIC uint16_t random16() { rand16seed = (rand16seed * FASTLED_RAND16_2053) + FASTLED_RAND16_13849; return rand16seed; }
+LIB8STATIC uint8_t random8(uint8_t lim) { uint8_t r = random8(); r = (r * lim) >> 8; return r; }
+LIB8STATIC uint8_t random8(uint8_t min, uint8_t lim) { uint8_t delta = lim - min; return random8(delta) + min; }
+LIB8STATIC uint16_t random16(uint16_t lim) { uint16_t r = random16(); uint32_t p = uint32_t(lim) * uint32_t(r); return p >> 16; }
+LIB8STATIC uint16_t random16(uint16_t min, uint16_t lim) { uint16_t delta = lim - min; return random16(delta) + min; }
+LIB8STATIC void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+LIB8STATIC uint16_t random16_get_seed() { return rand16seed; }
+LIB8STATIC void random16_add_entropy(uint16_t entropy) { rand16seed += entropy; }
+
+// ---- beats (millis based) ----
+LIB8STATIC uint16_t beat88(accum88 beats_per_minute_88, uint32_t timebase = 0) { return ((GET_MILLIS() - timebase) * beats_per_minute_88 * 280) >> 16; }
+LIB8STATIC uint16_t beat16(accum88 beats_per_minute, uint32_t timebase = 0) { if (beats_per_minute < 256) beats_per_minute <<= 8; return beat88(beats_per_minute, timebase); }
+LIB8STATIC uint8_t beat8(accum88 beats_per_minute, uint32_t timebase = 0) { return beat16(beats_per_minute, timebase) >> 8; }
+LIB8STATIC uint16_t beatsin88(accum88 beats_per_minute_88, uint16_t lowest = 0, uint16_t highest = 65535, uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat88(beats_per_minute_88, timebase);
+  uint16_t beatsin = (sin16(beat + phase_offset) + 32768);
+  uint16_t rangewidth = highest - lowest;
+  return lowest + scale16(beatsin, rangewidth);
+}
+LIB8STATIC uint16_t beatsin16(accum88 beats_per_minute, uint16_t lowest = 0, uint16_t highest = 65535, uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat16(beats_per_minute, timebase);
+  uint16_t beatsin = (sin16(beat + phase_offset) + 32768);
+  uint16_t rangewidth = highest - lowest;
+  return lowest + scale16(beatsin, rangewidth);
+}
+LIB8STATIC uint8_t beatsin8(accum88 beats_per_minute, uint8_t lowest = 0, uint8_t highest = 255, uint32_t timebase = 0, uint8_t phase_offset = 0) {
+  uint8_t beat = beat8(beats_per_minute, timebase);
+  uint8_t beatsin = sin8(beat + phase_offset);
+  uint8_t rangewidth = highest - lowest;
+  return lowest + scale8(beatsin, rangewidth);
+}
+
+// ---- noise ----
+uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z);
+uint16_t inoise16(uint32_t x, uint32_t y);
+uint16_t inoise16(uint32_t x);
+int16_t  inoise16_raw(uint32_t x, uint32_t y, uint32_t z);
+int16_t  inoise16_raw(uint32_t x, uint32_t y);
+int16_t  inoise16_raw(uint32_t x);
+uint8_t  inoise8(uint16_t x, uint16_t y, uint16_t z);
+uint8_t  inoise8(uint16_t x, uint16_t y);
+uint8_t  inoise8(uint16_t x);
+int8_t   inoise8_raw(uint16_t x, uint16_t y, uint16_t z);
+int8_t   inoise8_raw(uint16_t x, uint16_t y);
+int8_t   inoise8_raw(uint16_t x);
+
+// ---- colours ----
+struct CRGB;
+struct CHSV {
+  union {
+    struct { union { uint8_t hue; uint8_t h; }; union { uint8_t saturation; uint8_t sat; uint8_t s; }; union { uint8_t value; uint8_t val; uint8_t v; }; };
+    uint8_t raw[3];
+  };
+  inline uint8_t &operator[](uint8_t x) { return raw[x]; }
+  inline const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+  CHSV() : h(0), s(0), v(0) {}
+  constexpr CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+  CHSV(const CHSV &) = default;
+  CHSV &operator=(const CHSV &) = default;
+  inline CHSV &setHSV(uint8_t ih, uint8_t is, uint8_t iv) { h = ih; s = is; v = iv; return *this; }
+};
+typedef enum { HUE_RED = 0, HUE_ORANGE = 32, HUE_YELLOW = 64, HUE_GREEN = 96, HUE_AQUA = 128, HUE_BLUE = 160, HUE_PURPLE = 192, HUE_PINK = 224 } HSVHue;
+
+void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb);
+void hsv2rgb_rainbow(const CHSV *phsv, CRGB *prgb, int numLeds);
+void hsv2rgb_spectrum(const CHSV &hsv, CRGB &rgb);
+void hsv2rgb_raw(const CHSV &hsv, CRGB &rgb);
+CHSV rgb2hsv_approximate(const CRGB &rgb);
+#define hsv2rgb hsv2rgb_rainbow
+
+struct CRGB {
+  union {
+    struct { union { uint8_t r; uint8_t red; }; union { uint8_t g; uint8_t green; }; union { uint8_t b; uint8_t blue; }; };
+    uint8_t raw[3];
+  };
+  inline uint8_t &operator[](uint8_t x) { return raw[x]; }
+  inline const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+  CRGB() : r(0), g(0), b(0) {}
+  constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b((colorcode >> 0) & 0xFF) {}
+  CRGB(const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); }
+  CRGB(const CRGB &) = default;
+  CRGB &operator=(const CRGB &) = default;
+  inline CRGB &operator=(const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); return *this; }
+  inline CRGB &operator=(const uint32_t colorcode) { r = (colorcode >> 16) & 0xFF; g = (colorcode >> 8) & 0xFF; b = colorcode & 0xFF; return *this; }
+  inline CRGB &setRGB(uint8_t nr, uint8_t ng, uint8_t nb) { r = nr; g = ng; b = nb; return *this; }
+  inline CRGB &setHSV(uint8_t hue, uint8_t sat, uint8_t val) { hsv2rgb_rainbow(CHSV(hue, sat, val), *this); return *this; }
+  inline CRGB &setHue(uint8_t hue) { hsv2rgb_rainbow(CHSV(hue, 255, 255), *this); return *this; }
+  inline CRGB &setColorCode(uint32_t colorcode) { return (*this = colorcode); }
+
+  inline CRGB &operator+=(const CRGB &rhs) { r = qadd8(r, rhs.r); g = qadd8(g, rhs.g); b = qadd8(b, rhs.b); return *this; }
+  inline CRGB &addToRGB(uint8_t d) { r = qadd8(r, d); g = qadd8(g, d); b = qadd8(b, d); return *this; }
+  inline CRGB &operator-=(const CRGB &rhs) { r = qsub8(r, rhs.r); g = qsub8(g, rhs.g); b = qsub8(b, rhs.b); return *this; }
+  inline CRGB &subtractFromRGB(uint8_t d) { r = qsub8(r, d); g = qsub8(g, d); b = qsub8(b, d); return *this; }
+  inline CRGB &operator--() { subtractFromRGB(1); return *this; }
+  inline CRGB operator--(int) { CRGB retval(*this); --(*this); return retval; }
+  inline CRGB &operator++() { addToRGB(1); return *this; }
+  inline CRGB operator++(int) { CRGB retval(*this); ++(*this); return retval; }
+  inline CRGB &operator/=(uint8_t d) { r /= d; g /= d; b /= d; return *this; }
+  inline CRGB &operator>>=(uint8_t d) { r >>= d; g >>= d; b >>= d; return *this; }
+  inline CRGB &operator*=(uint8_t d) { r = qmul8(r, d); g = qmul8(g, d); b = qmul8(b, d); return *this; }
+  inline CRGB &nscale8_video(uint8_t scaledown) { nscale8x3_video(r, g, b, scaledown); return *this; }
+  inline CRGB &operator%=(uint8_t scaledown) { nscale8x3_video(r, g, b, scaledown); return *this; }
+  inline CRGB &fadeLightBy(uint8_t fadefactor) { nscale8x3_video(r, g, b, 255 - fadefactor); return *this; }
+  inline CRGB &nscale8(uint8_t scaledown) { nscale8x3(r, g, b, scaledown); return *this; }
+  inline CRGB &nscale8(const CRGB &s) { r = ::scale8(r, s.r); g = ::scale8(g, s.g); b = ::scale8(b, s.b); return *this; }
+  inline CRGB scale8(uint8_t scaledown) const { CRGB out = *this; nscale8x3(out.r, out.g, out.b, scaledown); return out; }
+  inline CRGB scale8(const CRGB &s) const { CRGB out; out.r = ::scale8(r, s.r); out.g = ::scale8(g, s.g); out.b = ::scale8(b, s.b); return out; }
+  inline CRGB &fadeToBlackBy(uint8_t fadefactor) { nscale8x3(r, g, b, 255 - fadefactor); return *this; }
+  inline CRGB &operator|=(const CRGB &rhs) { if (rhs.r > r) r = rhs.r; if (rhs.g > g) g = rhs.g; if (rhs.b > b) b = rhs.b; return *this; }
+  inline CRGB &operator|=(uint8_t d) { if (d > r) r = d; if (d > g) g = d; if (d > b) b = d; return *this; }
+  inline CRGB &operator&=(const CRGB &rhs) { if (rhs.r < r) r = rhs.r; if (rhs.g < g) g = rhs.g; if (rhs.b < b) b = rhs.b; return *this; }
+  inline CRGB &operator&=(uint8_t d) { if (d < r) r = d; if (d < g) g = d; if (d < b) b = d; return *this; }
+  inline explicit operator bool() const { return r || g || b; }
+  inline explicit operator uint32_t() const { return uint32_t(0xff000000) | (uint32_t(r) << 16) | (uint32_t(g) << 8) | uint32_t(b); }
+  inline CRGB operator-() const { return CRGB(255 - r, 255 - g, 255 - b); }
+  inline uint8_t getLuma() const { return ::scale8(r, 54) + ::scale8(g, 183) + ::scale8(b, 18); }
+  inline uint8_t getAverageLight() const { return ::scale8(r, 85) + ::scale8(g, 85) + ::scale8(b, 85); }
+  inline void maximizeBrightness(uint8_t limit = 255) {
+    uint8_t max = r; if (g > max) max = g; if (b > max) max = b;
+    if (max == 0) return;
+    uint16_t factor = ((uint16_t)(limit) * 256) / max;
+    r = (r * factor) / 256; g = (g * factor) / 256; b = (b * factor) / 256;
+  }
+  inline CRGB lerp8(const CRGB &other, fract8 frac) const { return CRGB(lerp8by8(r, other.r, frac), lerp8by8(g, other.g, frac), lerp8by8(b, other.b, frac)); }
+  inline CRGB lerp16(const CRGB &other, fract16 frac) const {
+    return CRGB(lerp16by16(r << 8, other.r << 8, frac) >> 8, lerp16by16(g << 8, other.g << 8, frac) >> 8, lerp16by16(b << 8, other.b << 8, frac) >> 8);
+  }
+  inline uint8_t getParity() { return (r + g + b) & 0x01; }
+
+  typedef enum {
+    AliceBlue=0xF0F8FF, Amethyst=0x9966CC, AntiqueWhite=0xFAEBD7, Aqua=0x00FFFF, Aquamarine=0x7FFFD4, Azure=0xF0FFFF, Beige=0xF5F5DC,
+    Bisque=0xFFE4C4, Black=0x000000, BlanchedAlmond=0xFFEBCD, Blue=0x0000FF, BlueViolet=0x8A2BE2, Brown=0xA52A2A, BurlyWood=0xDEB887,
+    CadetBlue=0x5F9EA0, Chartreuse=0x7FFF00, Chocolate=0xD2691E, Coral=0xFF7F50, CornflowerBlue=0x6495ED, Cornsilk=0xFFF8DC, Crimson=0xDC143C,
+    Cyan=0x00FFFF, DarkBlue=0x00008B, DarkCyan=0x008B8B, DarkGoldenrod=0xB8860B, DarkGray=0xA9A9A9, DarkGrey=0xA9A9A9, DarkGreen=0x006400,
+    DarkKhaki=0xBDB76B, DarkMagenta=0x8B008B, DarkOliveGreen=0x556B2F, DarkOrange=0xFF8C00, DarkOrchid=0x9932CC, DarkRed=0x8B0000,
+    DarkSalmon=0xE9967A, DarkSeaGreen=0x8FBC8F, DarkSlateBlue=0x483D8B, DarkSlateGray=0x2F4F4F, DarkSlateGrey=0x2F4F4F, DarkTurquoise=0x00CED1,
+    DarkViolet=0x9400D3, DeepPink=0xFF1493, DeepSkyBlue=0x00BFFF, DimGray=0x696969, DimGrey=0x696969, DodgerBlue=0x1E90FF, FireBrick=0xB22222,
+    FloralWhite=0xFFFAF0, ForestGreen=0x228B22, Fuchsia=0xFF00FF, Gainsboro=0xDCDCDC, GhostWhite=0xF8F8FF, Gold=0xFFD700, Goldenrod=0xDAA520,
+    Gray=0x808080, Grey=0x808080, Green=0x008000, GreenYellow=0xADFF2F, Honeydew=0xF0FFF0, HotPink=0xFF69B4, IndianRed=0xCD5C5C, Indigo=0x4B0082,
+    Ivory=0xFFFFF0, Khaki=0xF0E68C, Lavender=0xE6E6FA, LavenderBlush=0xFFF0F5, LawnGreen=0x7CFC00, LemonChiffon=0xFFFACD, LightBlue=0xADD8E6,
+    LightCoral=0xF08080, LightCyan=0xE0FFFF, LightGoldenrodYellow=0xFAFAD2, LightGreen=0x90EE90, LightGrey=0xD3D3D3, LightPink=0xFFB6C1,
+    LightSalmon=0xFFA07A, LightSeaGreen=0x20B2AA, LightSkyBlue=0x87CEFA, LightSlateGray=0x778899, LightSlateGrey=0x778899, LightSteelBlue=0xB0C4DE,
+    LightYellow=0xFFFFE0, Lime=0x00FF00, LimeGreen=0x32CD32, Linen=0xFAF0E6, Magenta=0xFF00FF, Maroon=0x800000, MediumAquamarine=0x66CDAA,
+    MediumBlue=0x0000CD, MediumOrchid=0xBA55D3, MediumPurple=0x9370DB, MediumSeaGreen=0x3CB371, MediumSlateBlue=0x7B68EE,
+    MediumSpringGreen=0x00FA9A, MediumTurquoise=0x48D1CC, MediumVioletRed=0xC71585, MidnightBlue=0x191970, MintCream=0xF5FFFA,
+    MistyRose=0xFFE4E1, Moccasin=0xFFE4B5, NavajoWhite=0xFFDEAD, Navy=0x000080, OldLace=0xFDF5E6, Olive=0x808000, OliveDrab=0x6B8E23,
+    Orange=0xFFA500, OrangeRed=0xFF4500, Orchid=0xDA70D6, PaleGoldenrod=0xEEE8AA, PaleGreen=0x98FB98, PaleTurquoise=0xAFEEEE,
+    PaleVioletRed=0xDB7093, PapayaWhip=0xFFEFD5, PeachPuff=0xFFDAB9, Peru=0xCD853F, Pink=0xFFC0CB, Plaid=0xCC5533, Plum=0xDDA0DD,
+    PowderBlue=0xB0E0E6, Purple=0x800080, Red=0xFF0000, RosyBrown=0xBC8F8F, RoyalBlue=0x4169E1, SaddleBrown=0x8B4513, Salmon=0xFA8072,
+    SandyBrown=0xF4A460, SeaGreen=0x2E8B57, Seashell=0xFFF5EE, Sienna=0xA0522D, Silver=0xC0C0C0, SkyBlue=0x87CEEB, SlateBlue=0x6A5ACD,
+    SlateGray=0x708090, SlateGrey=0x708090, Snow=0xFFFAFA, SpringGreen=0x00FF7F, SteelBlue=0x4682B4, Tan=0xD2B48C, Teal=0x008080,
+    Thistle=0xD8BFD8, Tomato=0xFF6347, Turquoise=0x40E0D0, Violet=0xEE82EE, Wheat=0xF5DEB3, White=0xFFFFFF, WhiteSmoke=0xF5F5F5,
+    Yellow=0xFFFF00, YellowGreen=0x9ACD32, FairyLight=0xFFE42D, FairyLightNCC=0xFF9D2A
+  } HTMLColorCode;
+};
+
+inline bool operator==(const CRGB &a, const CRGB &b) { return (a.r == b.r) && (a.g == b.g) && (a.b == b.b); }
+inline bool operator!=(const CRGB &a, const CRGB &b) { return !(a == b); }
+inline CRGB operator+(const CRGB &a, const CRGB &b) { return CRGB(qadd8(a.r, b.r), qadd8(a.g, b.g), qadd8(a.b, b.b)); }
+inline CRGB operator-(const CRGB &a, const CRGB &b) { return CRGB(qsub8(a.r, b.r), qsub8(a.g, b.g), qsub8(a.b, b.b)); }
+inline CRGB operator*(const CRGB &p, uint8_t d) { return CRGB(qmul8(p.r, d), qmul8(p.g, d), qmul8(p.b, d)); }
+inline CRGB operator/(const CRGB &p, uint8_t d) { return CRGB(p.r / d, p.g / d, p.b / d); }
+inline CRGB operator&(const CRGB &p1, const CRGB &p2) { return CRGB(p1.r < p2.r ? p1.r : p2.r, p1.g < p2.g ? p1.g : p2.g, p1.b < p2.b ? p1.b : p2.b); }
+inline CRGB operator|(const CRGB &p1, const CRGB &p2) { return CRGB(p1.r > p2.r ? p1.r : p2.r, p1.g > p2.g ? p1.g : p2.g, p1.b > p2.b ? p1.b : p2.b); }
+inline CRGB operator%(const CRGB &p1, uint8_t d) { CRGB retval(p1); retval.nscale8_video(d); return retval; }
+
+// ---- colour utilities ----
+void fill_solid(CRGB *targetArray, int numToFill, const CRGB &color);
+void fill_rainbow(CRGB *targetArray, int numToFill, uint8_t initialhue, uint8_t deltahue = 5);
+void fill_gradient_RGB(CRGB *leds, uint16_t startpos, CRGB startcolor, uint16_t endpos, CRGB endcolor);
+void fill_gradient_RGB(CRGB *leds, uint16_t numLeds, const CRGB &c1, const CRGB &c2);
+void fill_gradient_RGB(CRGB *leds, uint16_t numLeds, const CRGB &c1, const CRGB &c2, const CRGB &c3);
+void fill_gradient_RGB(CRGB *leds, uint16_t numLeds, const CRGB &c1, const CRGB &c2, const CRGB &c3, const CRGB &c4);
+void nscale8_video(CRGB *leds, uint16_t num_leds, uint8_t scale);
+void fade_video(CRGB *leds, uint16_t num_leds, uint8_t fadeBy);
+void fadeLightBy(CRGB *leds, uint16_t num_leds, uint8_t fadeBy);
+void nscale8(CRGB *leds, uint16_t num_leds, uint8_t scale);
+void fade_raw(CRGB *leds, uint16_t num_leds, uint8_t fadeBy);
+void fadeToBlackBy(CRGB *leds, uint16_t num_leds, uint8_t fadeBy);
+CRGB &nblend(CRGB &existing, const CRGB &overlay, fract8 amountOfOverlay);
+void nblend(CRGB *existing, CRGB *overlay, uint16_t count, fract8 amountOfOverlay);
+CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amountOfP2);
+CRGB *blend(const CRGB *src1, const CRGB *src2, CRGB *dest, uint16_t count, fract8 amountOfsrc2);
+CRGB HeatColor(uint8_t temperature);
+void blur1d(CRGB *leds, uint16_t numLeds, fract8 blur_amount);
+
+// ---- palettes ----
+typedef uint32_t TProgmemRGBPalette16[16];
+typedef uint8_t TProgmemRGBGradientPalette_byte;
+typedef const TProgmemRGBGradientPalette_byte *TProgmemRGBGradientPalette_bytes;
+typedef TProgmemRGBGradientPalette_bytes TProgmemRGBGradientPalettePtr;
+typedef TProgmemRGBGradientPalette_bytes TDynamicRGBGradientPalette_bytes;
+#define DEFINE_GRADIENT_PALETTE(X) extern const TProgmemRGBGradientPalette_byte X[] FL_PROGMEM =
+#define DECLARE_GRADIENT_PALETTE(X) extern const TProgmemRGBGradientPalette_byte X[] FL_PROGMEM
+
+typedef enum { NOBLEND = 0, LINEARBLEND = 1, LINEARBLEND_NOWRAP = 2 } TBlendType;
+
+class CRGBPalette16 {
+  public:
+    CRGB entries[16];
+    CRGBPalette16() {}
+    CRGBPalette16(const CRGB &c00, const CRGB &c01, const CRGB &c02, const CRGB &c03, const CRGB &c04, const CRGB &c05, const CRGB &c06, const CRGB &c07,
+                  const CRGB &c08, const CRGB &c09, const CRGB &c10, const CRGB &c11, const CRGB &c12, const CRGB &c13, const CRGB &c14, const CRGB &c15) {
+      entries[0] = c00; entries[1] = c01; entries[2] = c02; entries[3] = c03; entries[4] = c04; entries[5] = c05; entries[6] = c06; entries[7] = c07;
+      entries[8] = c08; entries[9] = c09; entries[10] = c10; entries[11] = c11; entries[12] = c12; entries[13] = c13; entries[14] = c14; entries[15] = c15;
+    }
+    CRGBPalette16(const CRGBPalette16 &rhs) = default;
+    CRGBPalette16 &operator=(const CRGBPalette16 &rhs) = default;
+    CRGBPalette16(const CRGB rhs[16]) { memmove(entries, rhs, sizeof(entries)); }
+    CRGBPalette16(const TProgmemRGBPalette16 &rhs) { for (int i = 0; i < 16; i++) entries[i] = rhs[i]; }
+    CRGBPalette16 &operator=(const TProgmemRGBPalette16 &rhs) { for (int i = 0; i < 16; i++) entries[i] = rhs[i]; return *this; }
+    CRGBPalette16(const CHSV &c1) { CRGB c(c1); fill_solid(entries, 16, c); }
+    CRGBPalette16(const CRGB &c1) { fill_solid(entries, 16, c1); }
+    CRGBPalette16(const CRGB &c1, const CRGB &c2) { fill_gradient_RGB(entries, 16, c1, c2); }
+    CRGBPalette16(const CRGB &c1, const CRGB &c2, const CRGB &c3) { fill_gradient_RGB(entries, 16, c1, c2, c3); }
+    CRGBPalette16(const CRGB &c1, const CRGB &c2, const CRGB &c3, const CRGB &c4) { fill_gradient_RGB(entries, 16, c1, c2, c3, c4); }
+    CRGBPalette16(TProgmemRGBGradientPalette_bytes progpal) { *this = progpal; }
+    CRGBPalette16 &operator=(TProgmemRGBGradientPalette_bytes progpal) { loadDynamicGradientPalette(progpal); return *this; }
+    CRGBPalette16 &loadDynamicGradientPalette(TDynamicRGBGradientPalette_bytes gpal);
+    bool operator==(const CRGBPalette16 &rhs) const { return memcmp(entries, rhs.entries, sizeof(entries)) == 0; }
+    bool operator!=(const CRGBPalette16 &rhs) const { return !(*this == rhs); }
+    inline CRGB &operator[](uint8_t x) { return entries[x]; }
+    inline const CRGB &operator[](uint8_t x) const { return entries[x]; }
+    operator CRGB *() { return &(entries[0]); }
+    operator const CRGB *() const { return &(entries[0]); }
+};
+
+CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255, TBlendType blendType = LINEARBLEND);
+void nblendPaletteTowardPalette(CRGBPalette16 &currentPalette, CRGBPalette16 &targetPalette, uint8_t maxChanges = 24);
+
+extern const TProgmemRGBPalette16 CloudColors_p;
+extern const TProgmemRGBPalette16 LavaColors_p;
+extern const TProgmemRGBPalette16 OceanColors_p;
+extern const TProgmemRGBPalette16 ForestColors_p;
+extern const TProgmemRGBPalette16 RainbowColors_p;
+extern const TProgmemRGBPalette16 RainbowStripeColors_p;
+#define RainbowStripesColors_p RainbowStripeColors_p
+extern const TProgmemRGBPalette16 PartyColors_p;
+extern const TProgmemRGBPalette16 HeatColors_p;
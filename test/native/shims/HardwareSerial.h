@@ -0,0 +1,3 @@
+#pragma once
+// Host stand-in: Serial lives in Arduino.h / Print.h
+#include "Arduino.h"
@@ -0,0 +1,35 @@
+#pragma once
+// Host stand-in for the Arduino IPAddress (IPv4 only)
+#include <stdint.h>
+#include <string.h>
+#include "WString.h"
+
+class IPAddress {
+  public:
+    IPAddress() { _a.dword = 0; }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { _a.bytes[0] = a; _a.bytes[1] = b; _a.bytes[2] = c; _a.bytes[3] = d; }
+    IPAddress(uint32_t addr) { _a.dword = addr; }
+    IPAddress(const uint8_t *addr) { memcpy(_a.bytes, addr, 4); }
+    operator uint32_t() const { return _a.dword; }
+    bool operator==(const IPAddress &o) const { return _a.dword == o._a.dword; }
+    bool operator!=(const IPAddress &o) const { return _a.dword != o._a.dword; }
+    bool operator==(const uint8_t *addr) const { return memcmp(addr, _a.bytes, 4) == 0; }
+    uint8_t operator[](int i) const { return _a.bytes[i]; }
+    uint8_t &operator[](int i) { return _a.bytes[i]; }
+    IPAddress &operator=(uint32_t addr) { _a.dword = addr; return *this; }
+    bool fromString(const char *s) {
+      unsigned v[4];
+      if (sscanf(s, "%u.%u.%u.%u", &v[0], &v[1], &v[2], &v[3]) != 4) return false;
+      for (int i = 0; i < 4; i++) { if (v[i] > 255) return false; _a.bytes[i] = v[i]; }
+      return true;
+    }
+    bool fromString(const String &s) { return fromString(s.c_str()); }
+    String toString() const {
+      char buf[16]; snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _a.bytes[0], _a.bytes[1], _a.bytes[2], _a.bytes[3]);
+      return String(buf);
+    }
+  private:
+    union { uint8_t bytes[4]; uint32_t dword; } _a;
+};
+
+extern const IPAddress INADDR_NONE;
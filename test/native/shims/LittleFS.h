@@ -0,0 +1,4 @@
+#pragma once
+// Host stand-in for LittleFS (see FS.h)
+#include "FS.h"
+extern fs::FS LittleFS;
@@ -0,0 +1,109 @@
+#pragma once
+// Host stand-in for NeoPixelBus: a pixel buffer without a wire. On the host bus_wrapper.h only
+// instantiates the soft/hard SPI types (DotStar, LPD, P9813, WS2801), all RGB (3 bytes per pixel).
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include "Arduino.h"
+
+// Asynchronous "wire" (host only): with hostWireTimeUs > 0, Show() hands the buffer to a thread that takes that long to
+// send it, like the RMT/I2S DMA methods, and CanShow() is false until it is done. Every frame sent is logged, and every
+// write to the driver buffer while a frame is on the wire counts as a tear.
+inline std::atomic<unsigned> hostWireTimeUs{0};
+inline std::atomic<unsigned> hostWireTears{0};
+inline std::mutex hostWireMutex;
+inline std::vector<std::vector<uint8_t>> hostWireFrames;
+
+struct RgbwColor;
+struct RgbColor {
+  uint8_t R = 0, G = 0, B = 0;
+  RgbColor() {}
+  RgbColor(uint8_t r, uint8_t g, uint8_t b) : R(r), G(g), B(b) {}
+  RgbColor(uint8_t v) : R(v), G(v), B(v) {}
+  inline RgbColor(const RgbwColor &c);
+};
+struct RgbwColor {
+  uint8_t R = 0, G = 0, B = 0, W = 0;
+  RgbwColor() {}
+  RgbwColor(uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) : R(r), G(g), B(b), W(w) {}
+  RgbwColor(const RgbColor &c) : R(c.R), G(c.G), B(c.B), W(0) {}
+};
+inline RgbColor::RgbColor(const RgbwColor &c) : R(c.R), G(c.G), B(c.B) {}
+
+struct NeoSpiSettings { uint32_t Clock; NeoSpiSettings(uint32_t clock) : Clock(clock) {} };
+struct NeoTm1814Settings { NeoTm1814Settings(uint16_t, uint16_t, uint16_t, uint16_t) {} };
+
+// features only select the channel order; the host keeps R,G,B in that order for every feature
+struct NeoHostFeature3 { static const size_t PixelSize = 3; };
+struct DotStarBgrFeature   : NeoHostFeature3 {};
+struct Lpd8806GrbFeature   : NeoHostFeature3 {};
+struct Lpd6803GrbFeature   : NeoHostFeature3 {};
+struct P9813BgrFeature     : NeoHostFeature3 {};
+struct NeoRbgFeature       : NeoHostFeature3 {};
+struct NeoGrbFeature       : NeoHostFeature3 {};
+
+struct NeoHostMethod {};
+struct DotStarMethod      : NeoHostMethod {};
+struct DotStarSpiHzMethod : NeoHostMethod {};
+struct Lpd8806Method      : NeoHostMethod {};
+struct Lpd8806SpiHzMethod : NeoHostMethod {};
+struct Lpd6803Method      : NeoHostMethod {};
+struct Lpd6803SpiHzMethod : NeoHostMethod {};
+struct P9813Method        : NeoHostMethod {};
+struct P9813SpiHzMethod   : NeoHostMethod {};
+struct Ws2801Method       : NeoHostMethod {};
+struct Ws2801SpiHzMethod  : NeoHostMethod {};
+
+struct NeoGammaNullMethod {};
+
+template<typename T_COLOR_FEATURE, typename T_METHOD, typename T_GAMMA = NeoGammaNullMethod>
+class NeoPixelBusLg {
+  public:
+    NeoPixelBusLg(uint16_t count, uint8_t = 0) : _buf(size_t(count) * T_COLOR_FEATURE::PixelSize, 0) {}
+    NeoPixelBusLg(uint16_t count, uint8_t, uint8_t) : NeoPixelBusLg(count) {}
+    ~NeoPixelBusLg() { if (_wire.joinable()) _wire.join(); }
+    void Begin() {}
+    void Begin(int8_t, int8_t, int8_t, int8_t) {}
+    void SetMethodSettings(const NeoSpiSettings &) {}
+    void SetPixelSettings(const NeoTm1814Settings &) {}
+    void Show(bool = true) {
+      _shows++;
+      const unsigned us = hostWireTimeUs;
+      if (!us) return;
+      if (_wire.joinable()) _wire.join(); // like the real driver, Show() waits for the previous frame
+      { std::lock_guard<std::mutex> lock(hostWireMutex); hostWireFrames.push_back(_buf); }
+      _busy = true;
+      _wire = std::thread([this, us] { std::this_thread::sleep_for(std::chrono::microseconds(us)); _busy = false; });
+    }
+    bool CanShow() const { return !_busy; }
+    void SetLuminance(uint8_t b) { _lum = b; }
+    uint8_t GetLuminance() const { return _lum; }
+    void ApplyPostAdjustments() {}
+    uint16_t PixelCount() const { return _buf.size() / T_COLOR_FEATURE::PixelSize; }
+    size_t PixelSize() const { return T_COLOR_FEATURE::PixelSize; }
+    size_t PixelsSize() const { return _buf.size(); }
+    uint8_t *Pixels() { return _buf.data(); }
+    void SetPixelColor(uint16_t i, const RgbColor &c) {
+      if (i >= PixelCount()) return;
+      if (_busy) hostWireTears++;
+      uint8_t *p = &_buf[size_t(i) * 3];
+      // the real NeoPixelBusLg applies luminance on write (gamma is the null method here)
+      p[0] = (uint16_t(c.R) * (_lum + 1)) >> 8; p[1] = (uint16_t(c.G) * (_lum + 1)) >> 8; p[2] = (uint16_t(c.B) * (_lum + 1)) >> 8;
+    }
+    void SetPixelColor(uint16_t i, const RgbwColor &c) { SetPixelColor(i, RgbColor(c)); }
+    RgbColor GetPixelColor(uint16_t i) const {
+      if (i >= PixelCount()) return RgbColor();
+      const uint8_t *p = &_buf[size_t(i) * 3];
+      return RgbColor(p[0], p[1], p[2]);
+    }
+    void ClearTo(const RgbColor &c) { for (uint16_t i = 0; i < PixelCount(); i++) SetPixelColor(i, c); }
+    unsigned long Shows() const { return _shows; } // host only: number of Show() calls
+  private:
+    std::vector<uint8_t> _buf;
+    uint8_t _lum = 255;
+    unsigned long _shows = 0;
+    std::atomic<bool> _busy{false};
+    std::thread _wire;
+};
@@ -0,0 +1,116 @@
+#pragma once
+// Host stand-in for Arduino Print / Stream / HardwareSerial; Serial writes to stderr (stdout stays free for program output)
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print;
+class Printable {
+  public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t size) { size_t n = 0; while (size--) n += write(*buf++); return n; }
+    size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+    size_t write(const char *buf, size_t size) { return write((const uint8_t *)buf, size); }
+    virtual void flush() {}
+    virtual int availableForWrite() { return 0; }
+
+    size_t print(const __FlashStringHelper *s) { return write(reinterpret_cast<const char *>(s)); }
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const char *s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC) { return (base == DEC) ? printf("%ld", v) : print(String(v, base)); }
+    size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(long long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(unsigned long long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+    size_t print(const Printable &x) { return x.printTo(*this); }
+
+    template<typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+    template<typename T> size_t println(const T &v, int base) { size_t n = print(v, base); return n + println(); }
+    size_t println() { return write("\r\n"); }
+
+    size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+      char buf[512];
+      va_list ap; va_start(ap, fmt);
+      int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+      va_end(ap);
+      if (n < 0) return 0;
+      return write((const uint8_t *)buf, (size_t(n) < sizeof(buf)) ? size_t(n) : sizeof(buf) - 1);
+    }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char *buf, size_t len) {
+      size_t n = 0;
+      while (n < len) { int c = read(); if (c < 0) break; buf[n++] = c; }
+      return n;
+    }
+    size_t readBytes(uint8_t *buf, size_t len) { return readBytes((char *)buf, len); }
+    String readStringUntil(char term) {
+      String r; int c;
+      while ((c = read()) >= 0 && c != term) r += char(c);
+      return r;
+    }
+    size_t readBytesUntil(char term, char *buf, size_t len) {
+      size_t n = 0;
+      while (n < len) { int c = read(); if (c < 0 || c == term) break; buf[n++] = c; }
+      return n;
+    }
+    size_t readBytesUntil(char term, uint8_t *buf, size_t len) { return readBytesUntil(term, (char *)buf, len); }
+    bool find(const char *target) { return findUntil(target, nullptr); }
+    bool find(const uint8_t *target, size_t) { return find((const char *)target); }
+    bool findUntil(const char *target, const char *term) {
+      size_t tl = strlen(target), tm = term ? strlen(term) : 0, ti = 0, mi = 0;
+      if (!tl) return true;
+      int c;
+      while ((c = read()) >= 0) {
+        ti = (c == target[ti]) ? ti + 1 : (c == target[0] ? 1 : 0);
+        if (ti == tl) return true;
+        if (tm) { mi = (c == term[mi]) ? mi + 1 : (c == term[0] ? 1 : 0); if (mi == tm) return false; }
+      }
+      return false;
+    }
+    String readString() { String r; int c; while ((c = read()) >= 0) r += char(c); return r; }
+    void setTimeout(unsigned long) {}
+};
+
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long, uint32_t = 0, int8_t = -1, int8_t = -1) {}
+    void end() {}
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stderr); }
+    size_t write(const uint8_t *buf, size_t size) override { return fwrite(buf, 1, size, stderr); }
+    using Print::write;
+    void flush() override { fflush(stderr); }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    int availableForWrite() override { return 128; }
+    unsigned long baudRate() { return 115200; }
+    operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
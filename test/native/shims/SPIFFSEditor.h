@@ -0,0 +1,7 @@
+#pragma once
+// Host stand-in for the /edit handler
+#include "ESPAsyncWebServer.h"
+class SPIFFSEditor : public AsyncWebHandler {
+  public:
+    SPIFFSEditor(const fs::FS &, const String & = String(), const String & = String()) {}
+};
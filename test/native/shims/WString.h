@@ -0,0 +1,137 @@
+#pragma once
+// Host stand-in for the Arduino String class (std::string underneath)
+#include <string>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+class __FlashStringHelper;
+
+class String {
+  public:
+    String() {}
+    String(const char *s) : _s(s ? s : "") {}
+    String(const char *s, unsigned len) : _s(s ? s : "", s ? len : 0) {}
+    String(const __FlashStringHelper *s) : _s(s ? reinterpret_cast<const char *>(s) : "") {}
+    String(const std::string &s) : _s(s) {}
+    String(const String &s) = default;
+    String(String &&s) = default;
+    explicit String(char c) : _s(1, c) {}
+    String(unsigned char v, unsigned char base = 10) { fromULong(v, base); }
+    String(int v, unsigned char base = 10) { fromLong(v, base); }
+    String(unsigned int v, unsigned char base = 10) { fromULong(v, base); }
+    String(long v, unsigned char base = 10) { fromLong(v, base); }
+    String(unsigned long v, unsigned char base = 10) { fromULong(v, base); }
+    String(long long v, unsigned char base = 10) { fromLong(v, base); }
+    String(unsigned long long v, unsigned char base = 10) { fromULong(v, base); }
+    explicit String(float v, unsigned char decimals = 2) { fromDouble(v, decimals); }
+    explicit String(double v, unsigned char decimals = 2) { fromDouble(v, decimals); }
+
+    String &operator=(const String &s) = default;
+    String &operator=(String &&s) = default;
+    String &operator=(const char *s) { _s = s ? s : ""; return *this; }
+    String &operator=(const __FlashStringHelper *s) { _s = s ? reinterpret_cast<const char *>(s) : ""; return *this; }
+
+    const char *c_str() const { return _s.c_str(); }
+    unsigned length() const { return _s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(unsigned n) { _s.reserve(n); return true; }
+    char charAt(unsigned i) const { return i < _s.size() ? _s[i] : 0; }
+    void setCharAt(unsigned i, char c) { if (i < _s.size()) _s[i] = c; }
+    char operator[](unsigned i) const { return charAt(i); }
+    char &operator[](unsigned i) { return _s[i]; }
+    char *begin() { return &_s[0]; }
+    char *end() { return &_s[0] + _s.size(); }
+
+    bool concat(const String &s) { _s += s._s; return true; }
+    bool concat(const char *s) { if (s) _s += s; return true; }
+    bool concat(char c) { _s += c; return true; }
+    template<typename T> bool concat(T v) { _s += String(v)._s; return true; }
+    String &operator+=(const String &s) { concat(s); return *this; }
+    String &operator+=(const char *s) { concat(s); return *this; }
+    String &operator+=(const __FlashStringHelper *s) { concat(reinterpret_cast<const char *>(s)); return *this; }
+    String &operator+=(char c) { concat(c); return *this; }
+    template<typename T> String &operator+=(T v) { concat(v); return *this; }
+
+    int compareTo(const String &s) const { return _s.compare(s._s); }
+    bool equals(const String &s) const { return _s == s._s; }
+    bool equals(const char *s) const { return _s == (s ? s : ""); }
+    bool equalsIgnoreCase(const String &s) const { return strcasecmp(_s.c_str(), s.c_str()) == 0; }
+    bool operator==(const String &s) const { return equals(s); }
+    bool operator==(const char *s) const { return equals(s); }
+    bool operator!=(const String &s) const { return !equals(s); }
+    bool operator!=(const char *s) const { return !equals(s); }
+    bool operator<(const String &s) const { return _s < s._s; }
+    bool operator>(const String &s) const { return _s > s._s; }
+    bool startsWith(const String &s) const { return _s.compare(0, s._s.size(), s._s) == 0; }
+    bool startsWith(const String &s, unsigned off) const { return off <= _s.size() && _s.compare(off, s._s.size(), s._s) == 0; }
+    bool endsWith(const String &s) const { return _s.size() >= s._s.size() && _s.compare(_s.size() - s._s.size(), s._s.size(), s._s) == 0; }
+
+    int indexOf(char c, unsigned from = 0) const { auto p = _s.find(c, from); return p == std::string::npos ? -1 : int(p); }
+    int indexOf(const String &s, unsigned from = 0) const { auto p = _s.find(s._s, from); return p == std::string::npos ? -1 : int(p); }
+    int lastIndexOf(char c) const { auto p = _s.rfind(c); return p == std::string::npos ? -1 : int(p); }
+    int lastIndexOf(const String &s) const { auto p = _s.rfind(s._s); return p == std::string::npos ? -1 : int(p); }
+    String substring(unsigned from) const { return from >= _s.size() ? String() : String(_s.substr(from)); }
+    String substring(unsigned from, unsigned to) const {
+      if (from > to) std::swap(from, to);
+      if (from >= _s.size()) return String();
+      return String(_s.substr(from, to - from));
+    }
+    void replace(char a, char b) { for (auto &c : _s) if (c == a) c = b; }
+    void replace(const String &a, const String &b) {
+      if (a._s.empty()) return;
+      size_t p = 0;
+      while ((p = _s.find(a._s, p)) != std::string::npos) { _s.replace(p, a._s.size(), b._s); p += b._s.size(); }
+    }
+    void remove(unsigned idx) { if (idx < _s.size()) _s.erase(idx); }
+    void remove(unsigned idx, unsigned n) { if (idx < _s.size()) _s.erase(idx, n); }
+    void toLowerCase() { for (auto &c : _s) c = tolower((unsigned char)c); }
+    void toUpperCase() { for (auto &c : _s) c = toupper((unsigned char)c); }
+    void trim() {
+      size_t b = 0, e = _s.size();
+      while (b < e && isspace((unsigned char)_s[b])) b++;
+      while (e > b && isspace((unsigned char)_s[e-1])) e--;
+      _s = _s.substr(b, e - b);
+    }
+    long toInt() const { return atol(_s.c_str()); }
+    float toFloat() const { return atof(_s.c_str()); }
+    double toDouble() const { return atof(_s.c_str()); }
+    void toCharArray(char *buf, unsigned size, unsigned index = 0) const { getBytes((unsigned char *)buf, size, index); }
+    void getBytes(unsigned char *buf, unsigned size, unsigned index = 0) const {
+      if (!size || !buf) return;
+      unsigned n = index < _s.size() ? std::min<unsigned>(size - 1, _s.size() - index) : 0;
+      memcpy(buf, _s.c_str() + index, n);
+      buf[n] = 0;
+    }
+
+    friend String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+    friend String operator+(const String &a, const char *b) { String r(a); r += b; return r; }
+    friend String operator+(const char *a, const String &b) { String r(a); r += b; return r; }
+    friend String operator+(const String &a, const __FlashStringHelper *b) { String r(a); r += b; return r; }
+    friend String operator+(const String &a, char b) { String r(a); r += b; return r; }
+    template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    friend String operator+(const String &a, T b) { String r(a); r += String(b); return r; }
+
+  private:
+    std::string _s;
+    void fromLong(long long v, unsigned char base) {
+      if (base == 10) { _s = std::to_string(v); return; }
+      fromULong((unsigned long long)v, base);
+    }
+    void fromULong(unsigned long long v, unsigned char base) {
+      if (base < 2 || base > 36) base = 10;
+      char buf[66]; int i = 65; buf[i] = 0;
+      do { unsigned d = v % base; buf[--i] = d < 10 ? '0' + d : 'a' + d - 10; v /= base; } while (v);
+      _s = &buf[i];
+    }
+    void fromDouble(double v, unsigned char decimals) { char buf[48]; snprintf(buf, sizeof(buf), "%.*f", decimals, v); _s = buf; }
+};
+
+// operator+ results on the ESP cores; only needed as a distinct type (ArduinoJson specializes on it)
+class StringSumHelper : public String {
+  public:
+    using String::String;
+    StringSumHelper(const String &s) : String(s) {}
+};
@@ -0,0 +1,66 @@
+#pragma once
+// Host stand-in for the ESP32 WiFi object: reports a connected station at 192.168.4.2,
+// so code paths that need a network (realtime output, notifications) run on the host.
+#include "Arduino.h"
+#include "esp_wifi.h"
+
+typedef enum { WL_NO_SHIELD = 255, WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL, WL_SCAN_COMPLETED, WL_CONNECTED, WL_CONNECT_FAILED, WL_CONNECTION_LOST, WL_DISCONNECTED } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+typedef enum { WIFI_AUTH_OPEN = 0, WIFI_AUTH_WEP, WIFI_AUTH_WPA_PSK, WIFI_AUTH_WPA2_PSK } wifi_auth_mode_t;
+typedef enum { WIFI_POWER_19_5dBm = 78, WIFI_POWER_8_5dBm = 34 } wifi_power_t;
+typedef int WiFiEvent_t;
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED  (-2)
+
+class WiFiClass {
+  public:
+    wl_status_t status() { return _status; }
+    bool isConnected() { return _status == WL_CONNECTED; }
+    bool mode(wifi_mode_t m) { _mode = m; return true; }
+    wifi_mode_t getMode() { return _mode; }
+    wl_status_t begin(const char * = nullptr, const char * = nullptr, int32_t = 0, const uint8_t * = nullptr, bool = true) { return _status; }
+    bool config(IPAddress, IPAddress, IPAddress, IPAddress = IPAddress(), IPAddress = IPAddress()) { return true; }
+    bool disconnect(bool = false, bool = false) { return true; }
+    bool softAP(const char *, const char * = nullptr, int = 1, int = 0, int = 4) { return true; }
+    bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+    bool softAPdisconnect(bool = false) { return true; }
+    uint8_t softAPgetStationNum() { return 0; }
+    IPAddress softAPIP() { return IPAddress(4, 3, 2, 1); }
+    IPAddress localIP() { return _ip; }
+    IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+    IPAddress gatewayIP() { return IPAddress(_ip[0], _ip[1], _ip[2], 1); }
+    IPAddress broadcastIP() { return IPAddress(_ip[0], _ip[1], _ip[2], 255); }
+    uint8_t *macAddress(uint8_t *mac) { const uint8_t m[6] = {0x02, 0x00, 0x00, 0xC0, 0xFF, 0xEE}; memcpy(mac, m, 6); return mac; }
+    String macAddress() { return String("02:00:00:C0:FF:EE"); }
+    String SSID() { return String("native"); }
+    String SSID(uint8_t) { return String("native"); }
+    String BSSIDstr() { return String("02:00:00:00:00:01"); }
+    String BSSIDstr(uint8_t) { return String("02:00:00:00:00:01"); }
+    int32_t RSSI() { return -50; }
+    int32_t RSSI(uint8_t) { return -50; }
+    int32_t channel() { return 1; }
+    int32_t channel(uint8_t) { return 1; }
+    wifi_auth_mode_t encryptionType(uint8_t) { return WIFI_AUTH_WPA2_PSK; }
+    int16_t scanNetworks(bool = false, bool = false) { return 0; }
+    int16_t scanComplete() { return 0; }
+    void scanDelete() {}
+    int hostByName(const char *name, IPAddress &result) { return result.fromString(name) ? 1 : 0; }
+    bool setHostname(const char *) { return true; }
+    const char *getHostname() { return "wled-native"; }
+    bool setSleep(bool) { return true; }
+    bool getSleep() { return false; }
+    bool setTxPower(wifi_power_t) { return true; }
+    wifi_power_t getTxPower() { return WIFI_POWER_19_5dBm; }
+    void persistent(bool) {}
+    void setAutoReconnect(bool) {}
+    int onEvent(std::function<void(WiFiEvent_t)>, WiFiEvent_t = 0) { return 0; }
+    // host only: pretend the station lost/regained its connection
+    void hostSetConnected(bool on) { _status = on ? WL_CONNECTED : WL_DISCONNECTED; _ip = on ? IPAddress(192, 168, 4, 2) : IPAddress(); }
+  private:
+    wl_status_t _status = WL_CONNECTED;
+    wifi_mode_t _mode = WIFI_STA;
+    IPAddress _ip = IPAddress(192, 168, 4, 2);
+};
+extern WiFiClass WiFi;
+
+#include "WiFiUdp.h"
@@ -0,0 +1,44 @@
+#pragma once
+// Host stand-in for WiFiUDP. Nothing touches a real socket: sent packets are appended to
+// hostUdpSent (a loopback the tests inspect), received packets come from hostUdpInject().
+#include <vector>
+#include <deque>
+#include "Arduino.h"
+
+struct HostUdpPacket {
+  IPAddress ip;         // destination (sent) or source (received)
+  uint16_t  port;       // destination port (sent) or local port (received)
+  std::vector<uint8_t> data;
+};
+extern std::vector<HostUdpPacket> hostUdpSent;
+void hostUdpInject(uint16_t localPort, IPAddress from, const uint8_t *data, size_t len);
+
+class WiFiUDP : public Stream {
+  public:
+    uint8_t begin(uint16_t port) { _localPort = port; return 1; }
+    uint8_t begin(IPAddress, uint16_t port) { return begin(port); }
+    uint8_t beginMulticast(IPAddress, uint16_t port) { return begin(port); }
+    void stop() { _localPort = 0; }
+    int beginPacket(IPAddress ip, uint16_t port) { _out.ip = ip; _out.port = port; _out.data.clear(); _writing = true; return 1; }
+    int beginPacket(const char *host, uint16_t port) { IPAddress ip; ip.fromString(host); return beginPacket(ip, port); }
+    int beginMulticastPacket() { return 1; }
+    int endPacket() { if (!_writing) return 0; hostUdpSent.push_back(_out); _writing = false; return 1; }
+    size_t write(uint8_t c) override { if (!_writing) return 0; _out.data.push_back(c); return 1; }
+    size_t write(const uint8_t *buf, size_t size) override { if (!_writing) return 0; _out.data.insert(_out.data.end(), buf, buf + size); return size; }
+    using Print::write;
+    int parsePacket();
+    int available() override { return _in.data.size() - _inPos; }
+    int read() override { return (_inPos < _in.data.size()) ? _in.data[_inPos++] : -1; }
+    int read(unsigned char *buf, size_t len) { size_t n = std::min(len, _in.data.size() - _inPos); memcpy(buf, _in.data.data() + _inPos, n); _inPos += n; return n; }
+    int read(char *buf, size_t len) { return read((unsigned char *)buf, len); }
+    int peek() override { return (_inPos < _in.data.size()) ? _in.data[_inPos] : -1; }
+    void flush() override { _in.data.clear(); _inPos = 0; }
+    IPAddress remoteIP() { return _in.ip; }
+    uint16_t remotePort() { return 0; }
+  private:
+    uint16_t _localPort = 0;
+    bool _writing = false;
+    HostUdpPacket _out;
+    HostUdpPacket _in;
+    size_t _inPos = 0;
+};
@@ -0,0 +1,15 @@
+#pragma once
+// Host stand-in: no I2C bus on the host
+#include "Arduino.h"
+class TwoWire {
+  public:
+    bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+    void setClock(uint32_t) {}
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission(bool = true) { return 2; }
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+    size_t write(uint8_t) { return 1; }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+extern TwoWire Wire;
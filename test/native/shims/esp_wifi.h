@@ -0,0 +1,5 @@
+#pragma once
+// Host stand-in: WiFi driver types only
+#include <stdint.h>
+typedef enum { WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+inline int esp_wifi_set_ps(wifi_ps_type_t) { return 0; }
@@ -0,0 +1,5 @@
+#pragma once
+// Host stand-in: multicast group membership is not modelled
+#include "ip_addr.h"
+inline int8_t igmp_joingroup(const ip4_addr_t *, const ip4_addr_t *) { return 0; }
+inline int8_t igmp_leavegroup(const ip4_addr_t *, const ip4_addr_t *) { return 0; }
@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in
+#include <stdint.h>
+#define LWIP_VERSION_MAJOR 2
+typedef struct { uint32_t addr; } ip4_addr_t;
+typedef ip4_addr_t ip_addr_t;
@@ -0,0 +1,17 @@
+/*
+ * [env:native] glue: defines the WLED globals (wled.cpp does this on the device) and stubs the
+ * functions of the translation units that are not part of the host build (web server, JSON API, WLED::setup/loop).
+ */
+#ifdef WLED_NATIVE
+#define WLED_DEFINE_GLOBAL_VARS
+#include "wled.h"
+
+WLED::WLED() {}
+void WLED::initAP(bool) {}
+
+bool deserializeState(JsonObject, byte, byte) { return false; }
+void serializeState(JsonObject, bool, bool, bool, bool) {}
+bool handleSet(AsyncWebServerRequest *, const String &, bool) { return false; }
+void sendDataWs(AsyncWebSocketClient *) {}
+void createEditHandler(bool) {}
+#endif
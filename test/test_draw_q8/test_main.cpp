@@ -0,0 +1,165 @@
+/*
+ * Q8.8 sub-pixel drawing: drawLineQ8() shades exactly the Wu coverage on both sides of the line, is independent of
+ * the endpoint order and of the axis it runs along, and point/line/circle leave the same picture whether the segment
+ * has a leds[] buffer (mixed in place) or not (getPixelColorXY()/setPixelColorXY() per tap).
+ *
+ *   pio test -e native -f test_draw_q8
+ */
+#include <unity.h>
+#include <vector>
+#include "wled.h"
+
+static const uint16_t W = 10, H = 7;
+static const uint32_t INK = RGBW32(255, 0, 0, 0);
+
+static void setupMatrix() {
+  suspendStripService = true;
+  busses.removeAll();
+  uint8_t pins[] = {23, 18};
+  BusConfig bc(TYPE_APA102, pins, 0, W * H, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY);
+  busses.add(bc);
+  strip.panel.clear();
+  strip.isMatrix = true;
+  WS2812FX::Panel p;
+  p.width = W; p.height = H;
+  strip.panels = 1;
+  strip.panel.push_back(p);
+  strip.finalizeInit();
+  strip.makeAutoSegments(true);
+}
+
+static void dropLeds(Segment &seg) {
+  if (seg.ledsrgb) free(seg.ledsrgb);
+  seg.ledsrgb = nullptr;
+  seg.ledsrgbSize = 0;
+}
+
+static void useLeds(Segment &seg, bool buffered) {
+  dropLeds(seg);
+  if (buffered) seg.setUpLeds();
+  TEST_ASSERT_EQUAL(buffered, seg.ledsrgb != nullptr);
+}
+
+static void clear(Segment &seg) {
+  for (uint16_t p = 0; p < W * H; p++) busses.setPixelColor(p, 0);
+  if (seg.ledsrgb) memset(seg.ledsrgb, 0, seg.ledsrgbSize);
+}
+
+static std::vector<uint32_t> virtualPixels(Segment &seg) {
+  std::vector<uint32_t> v;
+  for (int y = 0; y < seg.virtualHeight(); y++) for (int x = 0; x < seg.virtualWidth(); x++) v.push_back(seg.getPixelColorXY(x, y) & 0x00FFFFFF);
+  return v;
+}
+
+void setUp(void) {
+  setupMatrix();
+}
+
+void tearDown(void) {
+  dropLeds(strip.getSegment(0));
+}
+
+void test_line_on_pixel_centres(void) {
+  Segment &seg = strip.getSegment(0);
+  useLeds(seg, true);
+  clear(seg);
+  seg.drawLineQ8(1 << 8, 2 << 8, 8 << 8, 2 << 8, INK);
+  for (int y = 0; y < H; y++) for (int x = 0; x < W; x++) {
+    const uint32_t want = (y == 2 && x >= 1 && x <= 8) ? INK : 0;
+    TEST_ASSERT_EQUAL_HEX32(want, seg.getPixelColorXY(x, y));
+    TEST_ASSERT_EQUAL_HEX32(want, busses.getPixelColor(y * W + x)); // reached the LEDs, not only leds[]
+  }
+}
+
+void test_line_between_rows(void) {
+  Segment &seg = strip.getSegment(0);
+  useLeds(seg, true);
+  clear(seg);
+  seg.drawLineQ8(0, (3 << 8) + 128, 9 << 8, (3 << 8) + 128, INK); // y = 3.5: half coverage on rows 3 and 4
+  for (int x = 0; x < W; x++) {
+    TEST_ASSERT_EQUAL_HEX32(color_blend(0, INK, 127), seg.getPixelColorXY(x, 3));
+    TEST_ASSERT_EQUAL_HEX32(color_blend(0, INK, 128), seg.getPixelColorXY(x, 4));
+    TEST_ASSERT_EQUAL_HEX32(0, seg.getPixelColorXY(x, 2));
+    TEST_ASSERT_EQUAL_HEX32(0, seg.getPixelColorXY(x, 5));
+  }
+}
+
+void test_line_endpoint_order(void) {
+  static const int32_t lines[][4] = { {30, 40, 2200, 1500}, {2000, 100, 300, 1600}, {500, 1500, 600, 50}, {100, 100, 2300, 100} };
+  Segment &seg = strip.getSegment(0);
+  useLeds(seg, true);
+  for (const auto &l : lines) {
+    clear(seg);
+    seg.drawLineQ8(l[0], l[1], l[2], l[3], INK);
+    const std::vector<uint32_t> fwd = virtualPixels(seg);
+    clear(seg);
+    seg.drawLineQ8(l[2], l[3], l[0], l[1], INK);
+    const std::vector<uint32_t> back = virtualPixels(seg);
+    for (size_t i = 0; i < fwd.size(); i++) TEST_ASSERT_EQUAL_HEX32(fwd[i], back[i]);
+  }
+}
+
+void test_steep_line_is_mirrored_flat_line(void) {
+  Segment &seg = strip.getSegment(0);
+  seg.setUp(0, 7, 1, 0, 0, 0, 7); // square, so swapping x and y stays inside
+  useLeds(seg, true);
+  clear(seg);
+  seg.drawLineQ8(100, 300, 1500, 900, INK);   // flat
+  const std::vector<uint32_t> flat = virtualPixels(seg);
+  clear(seg);
+  seg.drawLineQ8(300, 100, 900, 1500, INK);   // the same line with x and y swapped
+  const std::vector<uint32_t> steep = virtualPixels(seg);
+  for (int y = 0; y < 7; y++) for (int x = 0; x < 7; x++) TEST_ASSERT_EQUAL_HEX32(flat[y * 7 + x], steep[x * 7 + y]);
+}
+
+// background pattern, then op; returns the LEDs followed by the virtual matrix
+template<typename Op> static std::vector<uint32_t> draw(Segment &seg, bool buffered, Op op) {
+  useLeds(seg, buffered);
+  clear(seg);
+  const int cols = seg.virtualWidth(), rows = seg.virtualHeight();
+  for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) seg.setPixelColorXY(x, y, RGBW32(x * 20 + 10, y * 30 + 10, (x * 7 + y * 13) & 0xFF, 0));
+  op(seg);
+  std::vector<uint32_t> pic;
+  for (uint16_t p = 0; p < W * H; p++) pic.push_back(busses.getPixelColor(p));
+  for (uint32_t c : virtualPixels(seg)) pic.push_back(c);
+  dropLeds(seg);
+  return pic;
+}
+
+template<typename Op> static void compare(const char *what, Op op) {
+  for (int tr = 0; tr < 2; tr++) for (int rx = 0; rx < 2; rx++) {
+    Segment &seg = strip.getSegment(0);
+    seg.setUp(1, 9, 1, 0, 0, 1, 6);
+    seg.transpose = tr;
+    seg.reverse   = rx;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s transpose %d reverse %d", what, tr, rx);
+    const std::vector<uint32_t> ref = draw(seg, false, op);
+    const std::vector<uint32_t> buf = draw(seg, true, op);
+    TEST_ASSERT_EQUAL_MESSAGE(ref.size(), buf.size(), msg);
+    for (size_t i = 0; i < ref.size(); i++) TEST_ASSERT_EQUAL_HEX32_MESSAGE(ref[i], buf[i], msg);
+  }
+}
+
+void test_buffered_matches_unbuffered(void) {
+  static const uint32_t colors[] = { RGBW32(200, 60, 255, 0), RGBW32(255, 255, 255, 0) };
+  for (uint32_t c : colors) for (int add = 0; add < 2; add++) {
+    char what[48];
+    snprintf(what, sizeof(what), "point %06X add %d", unsigned(c), add);
+    compare(what, [=](Segment &s) { s.setPixelColorXYQ8(300, 450, c, add); s.setPixelColorXYQ8(1024, 768, c, add); s.setPixelColorXYQ8(-100, 200, c, add); });
+    snprintf(what, sizeof(what), "line %06X add %d", unsigned(c), add);
+    compare(what, [=](Segment &s) { s.drawLineQ8(50, 70, 1700, 1100, c, add); s.drawLineQ8(1500, -200, 400, 1400, c, add); });
+    snprintf(what, sizeof(what), "circle %06X add %d", unsigned(c), add);
+    compare(what, [=](Segment &s) { s.drawCircleQ8(900, 600, 500, c, add); });
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_line_on_pixel_centres);
+  RUN_TEST(test_line_between_rows);
+  RUN_TEST(test_line_endpoint_order);
+  RUN_TEST(test_steep_line_is_mirrored_flat_line);
+  RUN_TEST(test_buffered_matches_unbuffered);
+  return UNITY_END();
+}
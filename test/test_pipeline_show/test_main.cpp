@@ -0,0 +1,128 @@
+/*
+ * Pipelined render/transmit (WLEDMM_PIPELINE_SHOW) on the host: the shim wire (hostWireTimeUs) sends each frame on its
+ * own thread, like RMT/I2S DMA. Checks that the next frame is rendered into the bus back buffer while the previous one
+ * is still being sent, that the driver buffer is never written during a transmission, and that frames go out whole and in order.
+ *
+ *   pio test -e native -f test_pipeline_show
+ */
+#include <unity.h>
+#include <thread>
+#include "NeoPixelBusLg.h" // host wire: hostWireTimeUs, hostWireFrames (before wled.h, which defines R() G() B() W())
+#include "wled.h"
+
+static const uint16_t LEN = 64;
+static unsigned long t = 1000; // effect time is frozen and advanced one frame per render, the wire runs in real time
+
+static void sleepMs(unsigned ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+static void setupStrip() {
+  suspendStripService = true;
+  busses.removeAll();
+  uint8_t pins[] = {23, 18};
+  BusConfig bc(TYPE_APA102, pins, 0, LEN, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY);
+  busses.add(bc);
+  strip.panel.clear();
+  strip.isMatrix = false;
+  strip.finalizeInit();
+  strip.makeAutoSegments(true);
+  strip.ablMilliampsMax = 0;  // no brightness limiter, frames are sent as rendered
+  strip.setBrightness(255, true);
+  bri = 255;
+  gammaCorrectCol = false;
+  strip.getSegment(0).setMode(FX_MODE_STATIC);
+}
+
+// renders frame k (a solid color of value k) and returns true if a frame was rendered
+static bool renderFrame(uint8_t k) {
+  Segment &seg = strip.getSegment(0);
+  seg.colors[0] = RGBW32(k, k, k, 0);
+  seg.next_time = 0;
+  t += 25;
+  hostSetMillis(t);
+  bool wasPending = strip.isFramePending();
+  strip.service();
+  return !wasPending && busses.getBus(0)->canShow() == false && strip.isFramePending();
+}
+
+void setUp(void) {
+  hostWireTimeUs = 0;
+  setupStrip();
+  renderFrame(0); // first frame after setup (segment start), on the instant wire
+  hostWireTears = 0;
+  hostWireFrames.clear();
+}
+
+void tearDown(void) {
+  hostWireTimeUs = 0;
+  busses.removeAll(); // joins the wire threads
+}
+
+static void waitWireIdle() {
+  for (int i = 0; i < 1000 && !busses.canAllShow(); i++) sleepMs(1);
+  TEST_ASSERT_TRUE(busses.canAllShow());
+}
+
+static void checkSentFrames(unsigned minFrames) {
+  std::lock_guard<std::mutex> lock(hostWireMutex);
+  TEST_ASSERT_GREATER_OR_EQUAL(minFrames, hostWireFrames.size());
+  int last = -1;
+  for (const auto &f : hostWireFrames) {
+    TEST_ASSERT_EQUAL(LEN * 3, f.size());
+    for (size_t i = 1; i < f.size(); i++) TEST_ASSERT_EQUAL_UINT8(f[0], f[i]); // one frame, not parts of two
+    TEST_ASSERT_GREATER_THAN(last, int(f[0]));                                 // in order, none sent twice
+    last = f[0];
+  }
+}
+
+// the default host wire is instant: the pipeline behaves like a synchronous show()
+void test_instant_wire_never_pends(void) {
+  for (uint8_t k = 1; k < 20; k++) {
+    renderFrame(k);
+    TEST_ASSERT_FALSE(strip.isFramePending());
+  }
+  TEST_ASSERT_EQUAL(0, hostWireTears);
+}
+
+// a slow wire: rendering continues while a frame is sent, the driver buffer only changes between transmissions
+void test_render_overlaps_transmit(void) {
+  hostWireTimeUs = 5000;
+  unsigned overlapped = 0;
+  for (uint8_t k = 1; k < 200; k++) {
+    if (renderFrame(k)) overlapped++;
+    sleepMs(1);
+  }
+  waitWireIdle();
+  TEST_ASSERT_GREATER_THAN(0, overlapped);
+  TEST_ASSERT_EQUAL(0, hostWireTears);
+  checkSentFrames(10);
+}
+
+// a parked frame is handed over as soon as the wire is idle, without rendering a new one
+void test_pending_frame_is_swapped_in(void) {
+  hostWireTimeUs = 20000;
+  renderFrame(10);              // sent at once
+  TEST_ASSERT_FALSE(strip.isFramePending());
+  renderFrame(20);              // rendered while 10 is on the wire -> parked in the back buffer
+  TEST_ASSERT_TRUE(strip.isFramePending());
+  renderFrame(30);              // still busy: must not render over the parked frame
+  TEST_ASSERT_TRUE(strip.isFramePending());
+  waitWireIdle();
+  t += 25;
+  hostSetMillis(t);
+  strip.service();              // swap
+  TEST_ASSERT_FALSE(strip.isFramePending());
+  waitWireIdle();
+  TEST_ASSERT_EQUAL(0, hostWireTears);
+  std::lock_guard<std::mutex> lock(hostWireMutex);
+  TEST_ASSERT_EQUAL(2, hostWireFrames.size());
+  TEST_ASSERT_EQUAL_UINT8(10, hostWireFrames[0][0]);
+  TEST_ASSERT_EQUAL_UINT8(20, hostWireFrames[1][0]);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_instant_wire_never_pends);
+  RUN_TEST(test_render_overlaps_transmit);
+  RUN_TEST(test_pending_frame_is_swapped_in);
+  return UNITY_END();
+}
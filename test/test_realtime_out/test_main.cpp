@@ -0,0 +1,296 @@
+/*
+ * Network output (realtimeBroadcast): DDP and Art-Net packets are compared byte for byte against packets built here
+ * straight from the protocol layout, through the host UDP loopback (hostUdpSent). Frame sizes cross the packet
+ * boundaries (480 RGB / 360 RGBW pixels per DDP packet, 170 RGB / 128 RGBW pixels per Art-Net and E1.31 universe).
+ * E1.31 also covers the start channel, the per-universe sequence numbers and the sync packet at the end of a frame.
+ *
+ *   pio test -e native -f test_realtime_out
+ */
+#include <unity.h>
+#include <vector>
+#include "wled.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static const IPAddress DEST(10, 0, 0, 42);
+static const std::vector<uint16_t> rgbSizes  = {1, 170, 171, 480, 481, 1000, 1440};
+static const std::vector<uint16_t> rgbwSizes = {1, 128, 129, 360, 361, 1000};
+static const uint8_t  bris[]      = {255, 200, 1};
+
+static uint8_t scale(uint8_t v, uint8_t bri) { return (uint16_t(v) * (1 + bri)) >> 8; }
+
+static Bytes makeFrame(uint16_t length, bool rgbw) {
+  Bytes buf(size_t(length) * (rgbw ? 4 : 3));
+  for (size_t i = 0; i < buf.size(); i++) buf[i] = uint8_t(i * 37 + (i >> 8) * 11 + 3);
+  return buf;
+}
+
+// DDP: 10 byte header (flags, sequence, data type, destination id, 32 bit offset, 16 bit length), up to 1440 data bytes
+static std::vector<Bytes> ddpReference(const Bytes &buf, uint8_t bri, bool rgbw) {
+  std::vector<Bytes> pkts;
+  for (size_t ofs = 0; ofs < buf.size(); ofs += 1440) {
+    const size_t n = std::min<size_t>(1440, buf.size() - ofs);
+    const bool last = (ofs + n == buf.size());
+    Bytes p = { uint8_t(0x40 | (last ? 0x01 : 0x00)), 0, uint8_t(rgbw ? 0x1B : 0x0B), 0x01,
+                uint8_t(ofs >> 24), uint8_t(ofs >> 16), uint8_t(ofs >> 8), uint8_t(ofs), uint8_t(n >> 8), uint8_t(n) };
+    for (size_t i = 0; i < n; i++) p.push_back(scale(buf[ofs + i], bri));
+    pkts.push_back(p);
+  }
+  return pkts;
+}
+
+// Art-Net ArtDmx: "Art-Net\0", OpDmx 0x5000 (LE), protocol 14, sequence, physical, universe (LE), length (BE)
+static std::vector<Bytes> artnetReference(const Bytes &buf, uint8_t bri, bool rgbw) {
+  const size_t perUniverse = rgbw ? 512 : 510;
+  std::vector<Bytes> pkts;
+  unsigned universe = 0;
+  for (size_t ofs = 0; ofs < buf.size(); ofs += perUniverse, universe++) {
+    const size_t n = std::min(perUniverse, buf.size() - ofs);
+    Bytes p = { 'A', 'r', 't', '-', 'N', 'e', 't', 0, 0x00, 0x50, 0x00, 14,
+                0, 0, uint8_t(universe), 0, uint8_t(n >> 8), uint8_t(n) };
+    for (size_t i = 0; i < n; i++) p.push_back(scale(buf[ofs + i], bri));
+    pkts.push_back(p);
+  }
+  return pkts;
+}
+
+static void put16(Bytes &p, size_t at, uint16_t v) { p[at] = v >> 8; p[at + 1] = v & 0xFF; }
+
+// E1.31 root layer (ANSI E1.31-2018 section 5): preamble, postamble, ACN packet identifier, flags+length, vector, CID
+static Bytes e131Root(size_t len, uint8_t vector) {
+  Bytes p(len, 0);
+  put16(p, 0, 0x0010);
+  const char acn[] = "ASC-E1.17";
+  memcpy(&p[4], acn, 9);
+  put16(p, 16, 0x7000 | (len - 16));
+  p[21] = vector;
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  memcpy(&p[22], "WLED-MM-sA", 10);
+  memcpy(&p[32], mac, 6);
+  return p;
+}
+
+// E1.31 data packets: pixels are not split across universes, the first universe starts at the start channel
+static std::vector<Bytes> e131Reference(const Bytes &buf, uint8_t bri, bool rgbw, uint16_t universe, uint16_t channel, uint8_t seq) {
+  const size_t cpp = rgbw ? 4 : 3;
+  std::vector<Bytes> pkts;
+  size_t ofs = 0;
+  for (unsigned u = 0; ofs < buf.size(); u++, universe++) {
+    const size_t first = (u == 0) ? channel - 1 : 0;
+    const size_t n = std::min((512 - first) / cpp * cpp, buf.size() - ofs);
+    if (n == 0) continue;
+    const size_t slots = first + n, len = 126 + slots;
+    Bytes p = e131Root(len, 0x04);
+    put16(p, 38, 0x7000 | (len - 38));
+    p[43] = 0x02;
+    strncpy((char*)&p[44], serverDescription, 64);
+    p[108] = e131OutPriority;
+    put16(p, 109, e131OutSyncUniverse);
+    p[111] = seq;
+    put16(p, 113, universe);
+    put16(p, 115, 0x7000 | (len - 115));
+    p[117] = 0x02;
+    p[118] = 0xA1;
+    put16(p, 121, 0x0001);
+    put16(p, 123, slots + 1);
+    for (size_t i = 0; i < n; i++) p[126 + first + i] = scale(buf[ofs + i], bri);
+    pkts.push_back(p);
+    ofs += n;
+  }
+  return pkts;
+}
+
+// E1.31 universe synchronization packet: 49 bytes, root vector 0x08, framing vector 0x01, sequence, sync universe
+static Bytes e131SyncReference(uint8_t seq, uint16_t syncUniverse) {
+  Bytes p = e131Root(49, 0x08);
+  put16(p, 38, 0x7000 | (49 - 38));
+  p[43] = 0x01;
+  p[44] = seq;
+  put16(p, 45, syncUniverse);
+  return p;
+}
+
+static void checkE131(const std::vector<Bytes> &expected, size_t first, IPAddress dest, const char *what) {
+  TEST_ASSERT_TRUE_MESSAGE(hostUdpSent.size() >= first + expected.size(), what);
+  for (size_t k = 0; k < expected.size(); k++) {
+    const HostUdpPacket &sent = hostUdpSent[first + k];
+    TEST_ASSERT_TRUE_MESSAGE(sent.ip == dest, what);
+    TEST_ASSERT_EQUAL_MESSAGE(E131_DEFAULT_PORT, sent.port, what);
+    TEST_ASSERT_EQUAL_MESSAGE(expected[k].size(), sent.data.size(), what);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected[k].data(), sent.data.data(), sent.data.size(), what);
+  }
+}
+
+// sequence numbers are shared by all outputs, so they are checked for their progression and not for a fixed value
+static void checkPackets(const std::vector<Bytes> &expected, uint16_t port, unsigned seqByte, const char *what) {
+  TEST_ASSERT_EQUAL_MESSAGE(expected.size(), hostUdpSent.size(), what);
+  for (size_t k = 0; k < expected.size(); k++) {
+    const HostUdpPacket &sent = hostUdpSent[k];
+    TEST_ASSERT_TRUE_MESSAGE(sent.ip == DEST, what);
+    TEST_ASSERT_EQUAL_MESSAGE(port, sent.port, what);
+    TEST_ASSERT_EQUAL_MESSAGE(expected[k].size(), sent.data.size(), what);
+    Bytes got = sent.data;
+    got[seqByte] = 0;
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected[k].data(), got.data(), got.size(), what);
+  }
+}
+
+void setUp(void) {
+  interfacesInited = true;
+  hostUdpSent.clear();
+}
+
+void tearDown(void) {
+  interfacesInited = false;
+  hostUdpSent.clear();
+}
+
+void test_ddp_packets(void) {
+  for (int rgbw = 0; rgbw < 2; rgbw++)
+  for (uint16_t len : (rgbw ? rgbwSizes : rgbSizes))
+  for (uint8_t bri : bris) {
+    char what[64];
+    snprintf(what, sizeof(what), "DDP %u %s pixels, bri %u", len, rgbw ? "RGBW" : "RGB", bri);
+    Bytes frame = makeFrame(len, rgbw);
+    hostUdpSent.clear();
+    TEST_ASSERT_EQUAL_MESSAGE(0, realtimeBroadcast(0, DEST, len, frame.data(), bri, rgbw), what);
+    checkPackets(ddpReference(frame, bri, rgbw), DDP_DEFAULT_PORT, 1, what);
+    for (size_t k = 1; k < hostUdpSent.size(); k++) // 4 bit sequence, one step per packet
+      TEST_ASSERT_EQUAL_MESSAGE((hostUdpSent[k-1].data[1] + 1) & 0x0F, hostUdpSent[k].data[1], what);
+  }
+}
+
+void test_artnet_packets(void) {
+  int lastSeq = -1;
+  for (int rgbw = 0; rgbw < 2; rgbw++)
+  for (uint16_t len : (rgbw ? rgbwSizes : rgbSizes))
+  for (uint8_t bri : bris) {
+    char what[64];
+    snprintf(what, sizeof(what), "Art-Net %u %s pixels, bri %u", len, rgbw ? "RGBW" : "RGB", bri);
+    Bytes frame = makeFrame(len, rgbw);
+    hostUdpSent.clear();
+    TEST_ASSERT_EQUAL_MESSAGE(0, realtimeBroadcast(2, DEST, len, frame.data(), bri, rgbw), what);
+    checkPackets(artnetReference(frame, bri, rgbw), ARTNET_DEFAULT_PORT, 12, what);
+    const uint8_t seq = hostUdpSent[0].data[12];  // one sequence number per frame, for all its universes
+    for (const HostUdpPacket &sent : hostUdpSent) TEST_ASSERT_EQUAL_MESSAGE(seq, sent.data[12], what);
+    if (lastSeq >= 0) TEST_ASSERT_EQUAL_MESSAGE((lastSeq + 1) & 0xFF, seq, what);
+    lastSeq = seq;
+  }
+}
+
+// the same through a DDP bus: pixels set on the bus, brightness applied when the bus is shown
+void test_ddp_bus_show(void) {
+  const uint16_t len = 600;
+  busses.removeAll();
+  uint8_t ip[] = {DEST[0], DEST[1], DEST[2], DEST[3]};
+  BusConfig bc(TYPE_NET_DDP_RGB, ip, 0, len, COL_ORDER_RGB);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, busses.add(bc));
+  Bytes frame = makeFrame(len, false);
+  for (uint16_t i = 0; i < len; i++) busses.setPixelColor(i, RGBW32(frame[i*3], frame[i*3+1], frame[i*3+2], 0));
+  busses.setBrightness(200);
+  hostUdpSent.clear();
+  busses.show();
+  checkPackets(ddpReference(frame, 200, false), DDP_DEFAULT_PORT, 1, "DDP bus");
+  busses.removeAll();
+}
+
+void test_e131_packets(void) {
+  static const uint16_t channels[] = {1, 5, 510, 512};
+  e131OutSyncUniverse = 0;
+  for (int rgbw = 0; rgbw < 2; rgbw++)
+  for (uint16_t len : (rgbw ? rgbwSizes : rgbSizes))
+  for (uint16_t channel : channels)
+  for (uint8_t bri : bris) {
+    char what[80];
+    snprintf(what, sizeof(what), "E1.31 %u %s pixels, channel %u, bri %u", len, rgbw ? "RGBW" : "RGB", channel, bri);
+    Bytes frame = makeFrame(len, rgbw);
+    uint8_t seq[E131_OUT_MAX_UNIVERSES] = {0};
+    for (uint8_t f = 0; f < 3; f++) { // every universe counts its own frames
+      hostUdpSent.clear();
+      TEST_ASSERT_EQUAL_MESSAGE(0, realtimeBroadcast(1, DEST, len, frame.data(), bri, rgbw, 7, channel, seq), what);
+      e131OutSync();
+      const std::vector<Bytes> expected = e131Reference(frame, bri, rgbw, 7, channel, f);
+      TEST_ASSERT_EQUAL_MESSAGE(expected.size(), hostUdpSent.size(), what); // no sync packet when the sync universe is off
+      checkE131(expected, 0, DEST, what);
+    }
+  }
+}
+
+void test_e131_sync_packet(void) {
+  const uint16_t len = 400; // 3 universes
+  Bytes frame = makeFrame(len, false);
+  uint8_t seq[E131_OUT_MAX_UNIVERSES] = {0};
+  e131OutSyncUniverse = 9000;
+  hostUdpSent.clear();
+  e131OutSync(); // nothing was sent in this frame: no sync
+  TEST_ASSERT_EQUAL(0, hostUdpSent.size());
+
+  int lastSync = -1;
+  for (int f = 0; f < 3; f++) {
+    hostUdpSent.clear();
+    TEST_ASSERT_EQUAL(0, realtimeBroadcast(1, DEST, len, frame.data(), 255, false, 1, 1, seq));
+    TEST_ASSERT_EQUAL(0, realtimeBroadcast(1, DEST, len, frame.data(), 255, false, 4, 1, seq + 3));
+    e131OutSync();
+    TEST_ASSERT_EQUAL(7, hostUdpSent.size()); // 2 x 3 universes, then one sync for the receiver
+    checkE131(e131Reference(frame, 255, false, 1, 1, f), 0, DEST, "E1.31 with sync, first output");
+    checkE131(e131Reference(frame, 255, false, 4, 1, f), 3, DEST, "E1.31 with sync, second output");
+    const uint8_t syncSeq = hostUdpSent[6].data[44];
+    checkE131({e131SyncReference(syncSeq, 9000)}, 6, DEST, "E1.31 sync packet");
+    if (lastSync >= 0) TEST_ASSERT_EQUAL((lastSync + 1) & 0xFF, syncSeq); // one step per frame
+    lastSync = syncSeq;
+  }
+
+  // multicast: data to 239.255.<universe>, one sync to 239.255.<sync universe>
+  e131OutMulticast = true;
+  hostUdpSent.clear();
+  TEST_ASSERT_EQUAL(0, realtimeBroadcast(1, DEST, len, frame.data(), 255, false, 1, 1, seq));
+  e131OutSync();
+  TEST_ASSERT_EQUAL(4, hostUdpSent.size());
+  for (int u = 0; u < 3; u++) TEST_ASSERT_TRUE(hostUdpSent[u].ip == IPAddress(239, 255, 0, 1 + u));
+  checkE131({e131SyncReference((lastSync + 1) & 0xFF, 9000)}, 3, IPAddress(239, 255, 9000 >> 8, 9000 & 0xFF), "E1.31 multicast sync");
+  e131OutMulticast = false;
+  e131OutSyncUniverse = 0;
+}
+
+// E1.31 busses: all data first, then exactly one sync packet per receiver from busses.show()
+void test_e131_bus_show(void) {
+  const IPAddress OTHER(10, 0, 0, 43);
+  const uint16_t len = 200;
+  busses.removeAll();
+  uint8_t ip1[] = {DEST[0], DEST[1], DEST[2], DEST[3]};
+  uint8_t ip2[] = {OTHER[0], OTHER[1], OTHER[2], OTHER[3]};
+  BusConfig a(TYPE_NET_E131_RGB, ip1, 0,       len, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY, 0, 1, 1);
+  BusConfig b(TYPE_NET_E131_RGB, ip1, len,     len, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY, 0, 3, 1);
+  BusConfig c(TYPE_NET_E131_RGB, ip2, 2 * len, len, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY, 0, 1, 100);
+  TEST_ASSERT_GREATER_OR_EQUAL(0, busses.add(a));
+  TEST_ASSERT_GREATER_OR_EQUAL(0, busses.add(b));
+  TEST_ASSERT_GREATER_OR_EQUAL(0, busses.add(c));
+  Bytes frame = makeFrame(len, false);
+  for (uint16_t i = 0; i < 3 * len; i++) busses.setPixelColor(i, RGBW32(frame[(i % len)*3], frame[(i % len)*3+1], frame[(i % len)*3+2], 0));
+  busses.setBrightness(255);
+  e131OutSyncUniverse = 64;
+  hostUdpSent.clear();
+  busses.show();
+  // 2 + 2 + 2 universes (the last output starts at channel 100), then the sync packets
+  TEST_ASSERT_EQUAL(8, hostUdpSent.size());
+  checkE131(e131Reference(frame, 255, false, 1, 1, 0),   0, DEST,  "E1.31 bus 1");
+  checkE131(e131Reference(frame, 255, false, 3, 1, 0),   2, DEST,  "E1.31 bus 2");
+  checkE131(e131Reference(frame, 255, false, 1, 100, 0), 4, OTHER, "E1.31 bus 3");
+  const uint8_t syncSeq = hostUdpSent[6].data[44];
+  checkE131({e131SyncReference(syncSeq, 64)}, 6, DEST,  "E1.31 bus sync 1");
+  checkE131({e131SyncReference(syncSeq, 64)}, 7, OTHER, "E1.31 bus sync 2");
+  e131OutSyncUniverse = 0;
+  busses.removeAll();
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_ddp_packets);
+  RUN_TEST(test_artnet_packets);
+  RUN_TEST(test_ddp_bus_show);
+  RUN_TEST(test_e131_packets);
+  RUN_TEST(test_e131_sync_packet);
+  RUN_TEST(test_e131_bus_show);
+  return UNITY_END();
+}
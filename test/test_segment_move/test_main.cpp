@@ -0,0 +1,118 @@
+/*
+ * 2D moveX()/moveY()/move(): segments with a leds[] buffer shift it with block copies and write it back once, segments
+ * without one go pixel by pixel through getPixelColorXY()/setPixelColorXY(). Both must leave the same picture on the
+ * LEDs and in the virtual matrix, also on transposed and reversed segments (leds[] holds the virtual, untransposed matrix).
+ *
+ *   pio test -e native -f test_segment_move
+ */
+#include <unity.h>
+#include <vector>
+#include "wled.h"
+
+static const uint16_t W = 10, H = 7; // matrix; the segment is 8x5 inside it, so transposing changes its shape
+
+static void setupMatrix() {
+  suspendStripService = true;
+  busses.removeAll();
+  uint8_t pins[] = {23, 18};
+  BusConfig bc(TYPE_APA102, pins, 0, W * H, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY);
+  busses.add(bc);
+  strip.panel.clear();
+  strip.isMatrix = true;
+  WS2812FX::Panel p;
+  p.width = W; p.height = H;
+  strip.panels = 1;
+  strip.panel.push_back(p);
+  strip.finalizeInit();
+  strip.makeAutoSegments(true);
+}
+
+struct Picture {
+  std::vector<uint32_t> leds;    // physical
+  std::vector<uint32_t> virt;    // virtual matrix as seen by effects
+};
+
+static void dropLeds(Segment &seg) {
+  if (seg.ledsrgb) free(seg.ledsrgb);
+  seg.ledsrgb = nullptr;
+  seg.ledsrgbSize = 0;
+}
+
+// draws a test pattern into the segment, runs op, returns the result
+template<typename Op> static Picture run(Segment &seg, bool buffered, Op op) {
+  dropLeds(seg);
+  if (buffered) seg.setUpLeds();
+  TEST_ASSERT_EQUAL(buffered, seg.ledsrgb != nullptr);
+  for (uint16_t p = 0; p < W * H; p++) busses.setPixelColor(p, 0);
+  const int cols = seg.virtualWidth(), rows = seg.virtualHeight();
+  for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) seg.setPixelColorXY(x, y, RGBW32(x * 20 + 10, y * 30 + 10, (x * 7 + y * 13) & 0xFF, 0));
+  op(seg);
+  Picture pic;
+  for (uint16_t p = 0; p < W * H; p++) pic.leds.push_back(busses.getPixelColor(p));
+  for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) pic.virt.push_back(seg.getPixelColorXY(x, y) & 0x00FFFFFF);
+  dropLeds(seg);
+  return pic;
+}
+
+template<typename Op> static void compare(const char *what, Op op) {
+  unsigned combos = 0;
+  for (int tr = 0; tr < 2; tr++) for (int rx = 0; rx < 2; rx++) for (int ry = 0; ry < 2; ry++) {
+    Segment &seg = strip.getSegment(0);
+    seg.setUp(1, 9, 1, 0, 0, 1, 6);
+    seg.transpose = tr;
+    seg.reverse   = rx;
+    seg.reverse_y = ry;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s transpose %d reverse %d reverse_y %d", what, tr, rx, ry);
+    Picture ref = run(seg, false, op);
+    Picture buf = run(seg, true, op);
+    TEST_ASSERT_EQUAL_MESSAGE(ref.virt.size(), buf.virt.size(), msg);
+    for (size_t i = 0; i < ref.leds.size(); i++) TEST_ASSERT_EQUAL_HEX32_MESSAGE(ref.leds[i], buf.leds[i], msg);
+    for (size_t i = 0; i < ref.virt.size(); i++) TEST_ASSERT_EQUAL_HEX32_MESSAGE(ref.virt[i], buf.virt[i], msg);
+    combos++;
+  }
+  TEST_ASSERT_EQUAL(8, combos);
+}
+
+void setUp(void) {
+  setupMatrix();
+}
+
+void tearDown(void) {
+  dropLeds(strip.getSegment(0));
+}
+
+void test_moveX(void) {
+  static const int8_t deltas[] = {-7, -3, -1, 1, 3, 7};
+  for (int8_t d : deltas) for (int wrap = 0; wrap < 2; wrap++) {
+    char what[32];
+    snprintf(what, sizeof(what), "moveX(%d, %d)", d, wrap);
+    compare(what, [=](Segment &s) { s.moveX(d, wrap); });
+  }
+}
+
+void test_moveY(void) {
+  static const int8_t deltas[] = {-7, -3, -1, 1, 3, 7};
+  for (int8_t d : deltas) for (int wrap = 0; wrap < 2; wrap++) {
+    char what[32];
+    snprintf(what, sizeof(what), "moveY(%d, %d)", d, wrap);
+    compare(what, [=](Segment &s) { s.moveY(d, wrap); });
+  }
+}
+
+void test_move_all_directions(void) {
+  static const uint8_t deltas[] = {1, 2, 4};
+  for (uint8_t dir = 0; dir < 8; dir++) for (uint8_t d : deltas) for (int wrap = 0; wrap < 2; wrap++) {
+    char what[32];
+    snprintf(what, sizeof(what), "move(%u, %u, %d)", dir, d, wrap);
+    compare(what, [=](Segment &s) { s.move(dir, d, wrap); });
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_moveX);
+  RUN_TEST(test_moveY);
+  RUN_TEST(test_move_all_directions);
+  return UNITY_END();
+}
@@ -0,0 +1,162 @@
+/*
+ * 1D segment index table (WLEDMM_SEGMENT_PIXELMAP): Segment::setPixelColor() through the precomputed table must
+ * write exactly the same LEDs as the per-pixel arithmetic (old path) for every grouping, spacing, reverse, mirror
+ * and offset, with and without a ledmap. The compiled .lmap is rebuilt whenever its .json source changes.
+ *
+ *   pio test -e native -f test_segment_pixelmap
+ */
+#include <unity.h>
+#include <vector>
+#include "wled.h"
+
+static const uint16_t LEN = 60;
+static const uint32_t UNSET = 0x00A5A5A5; // never written by the tests
+
+static void setupStrip() {
+  suspendStripService = true;
+  busses.removeAll();
+  uint8_t pins[] = {23, 18};
+  BusConfig bc(TYPE_APA102, pins, 0, LEN, COL_ORDER_RGB, false, 0, RGBW_MODE_MANUAL_ONLY);
+  busses.add(bc);
+  strip.panel.clear();
+  strip.isMatrix = false;
+  strip.finalizeInit();
+  strip.makeAutoSegments(true);
+}
+
+// writes a distinct color to every virtual pixel, returns what ended up on the busses
+static std::vector<uint32_t> paint(Segment &seg) {
+  for (uint16_t p = 0; p < LEN; p++) busses.setPixelColor(p, UNSET);
+  const int vLen = seg.virtualLength();
+  for (int i = 0; i < vLen; i++) seg.setPixelColor(i, RGBW32(i + 1, 255 - i, (i * 7) & 0xFF, 0));
+  std::vector<uint32_t> leds(LEN);
+  for (uint16_t p = 0; p < LEN; p++) leds[p] = busses.getPixelColor(p);
+  return leds;
+}
+
+static void compareAllGeometries(void) {
+  static const uint8_t groupings[] = {1, 2, 3};
+  static const uint8_t spacings[]  = {0, 1, 2};
+  static const uint16_t offsets[]  = {0, 1, 7, 41};
+  unsigned tested = 0;
+  for (uint8_t grp : groupings) for (uint8_t spc : spacings) for (uint16_t ofs : offsets)
+  for (int rev = 0; rev < 2; rev++) for (int mir = 0; mir < 2; mir++) {
+    Segment &seg = strip.getSegment(0);
+    seg.setUp(5, 47, grp, spc, ofs);
+    seg.reverse = rev;
+    seg.mirror  = mir;
+    char what[96];
+    snprintf(what, sizeof(what), "grouping %u spacing %u offset %u reverse %d mirror %d", grp, spc, ofs, rev, mir);
+
+    seg.deletePixelMap();                 // old path
+    std::vector<uint32_t> expected = paint(seg);
+    seg.updatePixelMap();                 // table path
+    TEST_ASSERT_TRUE_MESSAGE(seg.pixelMapValid(), what);
+    std::vector<uint32_t> actual = paint(seg);
+    for (uint16_t p = 0; p < LEN; p++) TEST_ASSERT_EQUAL_HEX32_MESSAGE(expected[p], actual[p], what);
+    tested++;
+  }
+  TEST_ASSERT_EQUAL(3 * 3 * 4 * 2 * 2, tested);
+}
+
+void setUp(void) {
+  LittleFS.begin();
+  setupStrip();
+}
+
+void tearDown(void) {
+  LittleFS.remove("/ledmap.json");
+  LittleFS.remove("/ledmap.lmap");
+  strip.deserializeMap(); // back to the identity mapping
+  strip.getSegment(0).deletePixelMap();
+}
+
+void test_table_matches_old_path(void) {
+  compareAllGeometries();
+}
+
+// a ledmap is resolved into the table as well
+void test_table_matches_old_path_with_ledmap(void) {
+  File f = LittleFS.open("/ledmap.json", "w");
+  TEST_ASSERT_TRUE(f);
+  f.print("{\"map\":[");
+  for (int i = 0; i < LEN; i++) f.printf("%s%d", i ? "," : "", (i * 17) % LEN); // 17 and 60 are coprime: a permutation
+  f.print("]}");
+  f.close();
+  TEST_ASSERT_TRUE(strip.deserializeMap());
+  TEST_ASSERT_EQUAL(17, strip.getMappedPixelIndex(1));
+  compareAllGeometries();
+}
+
+static void writeLedmap(unsigned step, const char *tail = "") {
+  File f = LittleFS.open("/ledmap.json", "w");
+  TEST_ASSERT_TRUE(f);
+  f.print("{\"map\":[");
+  for (int i = 0; i < LEN; i++) f.printf("%s%u", i ? "," : "", (i * step) % LEN);
+  f.printf("]}%s", tail);
+  f.close();
+}
+
+static std::vector<uint8_t> readFile(const char *name) {
+  File f = LittleFS.open(name, "r");
+  std::vector<uint8_t> data(f ? f.size() : 0);
+  if (f) { f.read(data.data(), data.size()); f.close(); }
+  return data;
+}
+
+static uint32_t referenceCrc32(const std::vector<uint8_t> &data) { // bitwise IEEE 802.3, as zlib crc32()
+  uint32_t crc = 0xFFFFFFFF;
+  for (uint8_t b : data) { crc ^= b; for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1))); }
+  return ~crc;
+}
+
+// the compiled .lmap records size and CRC32 of its .json source, and is rebuilt after any edit of the source
+void test_compiled_ledmap_follows_source(void) {
+  writeLedmap(17);
+  TEST_ASSERT_TRUE(strip.deserializeMap());
+  TEST_ASSERT_EQUAL(17, strip.getMappedPixelIndex(1));
+  const std::vector<uint8_t> src = readFile("/ledmap.json");
+  const std::vector<uint8_t> bin = readFile("/ledmap.lmap");
+  TEST_ASSERT_GREATER_OR_EQUAL(12, bin.size());
+  uint32_t srcSize, srcCrc;
+  memcpy(&srcSize, &bin[4], 4);
+  memcpy(&srcCrc,  &bin[8], 4);
+  TEST_ASSERT_EQUAL(src.size(), srcSize);
+  TEST_ASSERT_EQUAL_HEX32(referenceCrc32(src), srcCrc);
+
+  TEST_ASSERT_TRUE(strip.deserializeMap()); // unchanged: loaded from the .lmap
+  TEST_ASSERT_EQUAL(17, strip.getMappedPixelIndex(1));
+
+  writeLedmap(23);                          // another permutation of 0..59: same size, caught by the CRC
+  TEST_ASSERT_EQUAL(src.size(), readFile("/ledmap.json").size());
+  TEST_ASSERT_TRUE(strip.deserializeMap());
+  TEST_ASSERT_EQUAL(23, strip.getMappedPixelIndex(1));
+
+  writeLedmap(7, "\n");                     // size changed
+  TEST_ASSERT_TRUE(strip.deserializeMap());
+  TEST_ASSERT_EQUAL(7, strip.getMappedPixelIndex(1));
+}
+
+// a stale table (geometry changed behind its back) is not used
+void test_stale_table_is_ignored(void) {
+  Segment &seg = strip.getSegment(0);
+  seg.setUp(0, 30, 1, 0, 0);
+  seg.updatePixelMap();
+  TEST_ASSERT_TRUE(seg.pixelMapValid());
+  seg.mirror = true;
+  TEST_ASSERT_FALSE(seg.pixelMapValid());
+  Segment::invalidatePixelMaps();
+  seg.mirror = false;
+  TEST_ASSERT_FALSE(seg.pixelMapValid());
+  seg.updatePixelMap();
+  TEST_ASSERT_TRUE(seg.pixelMapValid());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_matches_old_path);
+  RUN_TEST(test_table_matches_old_path_with_ledmap);
+  RUN_TEST(test_stale_table_is_ignored);
+  RUN_TEST(test_compiled_ledmap_follows_source);
+  return UNITY_END();
+}
@@ -5072,11 +5072,16 @@ uint16_t mode_2DDrift() {              // By: Stepko   https://editor.soulmateli
   const uint16_t maxDim = MAX(cols, rows)/2;
   unsigned long t = strip.now / (32 - (SEGMENT.speed>>3));
   unsigned long t_20 = t/20; // softhack007: pre-calculating this gives about 10% speedup
-  for (float i = 1; i < maxDim; i += 0.25) {
-    float angle = radians(t * (maxDim - i));
-    uint16_t myX = (cols>>1) + (uint16_t)(sinf(angle) * i) + (cols%2);
-    uint16_t myY = (rows>>1) + (uint16_t)(cosf(angle) * i) + (rows%2);
-    SEGMENT.setPixelColorXY(myX, myY, ColorFromPalette(SEGPALETTE, (i * 20) + t_20, 255, LINEARBLEND));
+  // WLEDMM integer version: radius in quarter pixels, angle in quarter degrees, positions in Q8.8
+  const int32_t centerX = ((cols>>1) + (cols%2)) << 8;
+  const int32_t centerY = ((rows>>1) + (rows%2)) << 8;
+  const uint32_t tq = t % 1440;
+  for (int q = 4; q < 4*maxDim; q++) {
+    uint16_t angle = ((tq * (4*maxDim - q)) % 1440) * 2048 / 45;  // quarter degrees -> sin16 units
+    int32_t myX = centerX + ((int32_t(sin16(angle)) * q) >> 9);
+    int32_t myY = centerY + ((int32_t(cos16(angle)) * q) >> 9);
+    CRGB c = ColorFromPalette(SEGPALETTE, q*5 + t_20, 255, LINEARBLEND);
+    SEGMENT.setPixelColorXYQ8(myX, myY, RGBW32(c.r, c.g, c.b, 0));
   }
   SEGMENT.blur(SEGMENT.intensity>>3);
 
@@ -5150,19 +5155,63 @@ static const char _data_FX_MODE_2DFRIZZLES[] PROGMEM = "Frizzles@X frequency,Y f
 ///////////////////////////////////////////
 //   2D Cellular Automata Game of life   //
 ///////////////////////////////////////////
-static bool getBitValue(const uint8_t* byteArray, size_t n) {
-    size_t byteIndex = n / 8;
-    size_t bitIndex = n % 8;
-    uint8_t byte = byteArray[byteIndex];
-    return (byte >> bitIndex) & 1;
-}
-static void setBitValue(uint8_t* byteArray, size_t n, bool value) {
-    size_t byteIndex = n / 8;
-    size_t bitIndex = n % 8;
-    if (value)
-        byteArray[byteIndex] |= (1 << bitIndex); 
-    else
-        byteArray[byteIndex] &= ~(1 << bitIndex);
+// WLEDMM cells are stored row by row in 32bit words (bit x%32 of word x/32), so that a generation step
+// can process 32 cells at once with bit-sliced adders instead of counting neighbours cell by cell
+static inline bool golGet(const uint32_t *board, unsigned words, int x, int y) { return (board[y * words + (x >> 5)] >> (x & 31)) & 1; }
+static inline void golSet(uint32_t *board, unsigned words, int x, int y) { board[y * words + (x >> 5)] |= 1U << (x & 31); }
+
+// horizontal neighbours of a row: west[] has the cell at x-1 in bit x, east[] the cell at x+1
+static void golShiftRow(const uint32_t *row, unsigned words, unsigned cols, bool wrap, uint32_t *west, uint32_t *east) {
+  const unsigned lastBit = (cols - 1) & 31;
+  for (unsigned k = 0; k < words; k++) {
+    west[k] = (row[k] << 1) | ((k > 0) ? (row[k-1] >> 31) : 0);
+    east[k] = (row[k] >> 1) | ((k+1 < words) ? (row[k+1] << 31) : 0);
+  }
+  if (wrap) {
+    west[0] |= (row[words-1] >> lastBit) & 1;  // x = -1 is x = cols-1
+    east[words-1] |= (row[0] & 1) << lastBit;  // x = cols is x = 0
+  }
+}
+
+// full adder on 32 cells at once
+static inline void golAdd3(uint32_t a, uint32_t b, uint32_t c, uint32_t &sum, uint32_t &carry) {
+  uint32_t t = a ^ b;
+  sum   = t ^ c;
+  carry = (a & b) | (t & c);
+}
+
+// compute the next generation (B3/S23) of all cells; returns true if any cell changed
+static bool golStep(const uint32_t *cells, uint32_t *next, unsigned cols, unsigned rows, bool wrap) {
+  const unsigned words = (cols + 31) / 32;
+  const uint32_t lastMask = (cols & 31) ? ((1U << (cols & 31)) - 1) : 0xFFFFFFFFU; // padding bits stay zero
+  uint32_t zero[words];
+  uint32_t aW[words], aE[words], bW[words], bE[words], cW[words], cE[words];
+  memset(zero, 0, sizeof(zero));
+  uint32_t changed = 0;
+  for (unsigned y = 0; y < rows; y++) {
+    const uint32_t *above = (y > 0)        ? &cells[(y-1) * words] : (wrap ? &cells[(rows-1) * words] : zero);
+    const uint32_t *row   = &cells[y * words];
+    const uint32_t *below = (y + 1 < rows) ? &cells[(y+1) * words] : (wrap ? cells : zero);
+    golShiftRow(above, words, cols, wrap, aW, aE);
+    golShiftRow(row,   words, cols, wrap, bW, bE);
+    golShiftRow(below, words, cols, wrap, cW, cE);
+    for (unsigned k = 0; k < words; k++) {
+      uint32_t sA, cA, sC, cC, s0, c1, t0, t1;
+      golAdd3(aW[k], above[k], aE[k], sA, cA);  // row above: 3 neighbours
+      uint32_t sB = bW[k] ^ bE[k];              // own row: 2 neighbours
+      uint32_t cB = bW[k] & bE[k];
+      golAdd3(cW[k], below[k], cE[k], sC, cC);  // row below: 3 neighbours
+      golAdd3(sA, sB, sC, s0, c1);              // bit 0 of the count, c1 has weight 2
+      golAdd3(cA, cB, cC, t0, t1);              // weight 2 + carry with weight 4
+      uint32_t two  = t0 ^ c1;                  // bit 1 of the count
+      uint32_t four = t1 | (t0 & c1);           // 4 or more neighbours
+      uint32_t n = two & ~four & (s0 | row[k]); // 3 neighbours, or 2 neighbours and alive
+      if (k == words-1) n &= lastMask;
+      next[y * words + k] = n;
+      changed |= n ^ row[k];
+    }
+  }
+  return changed != 0;
 }
 
 uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https://natureofcode.com/book/chapter-7-cellular-automata/ 
@@ -5171,13 +5220,14 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
 
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
-  const size_t dataSize = ((SEGMENT.length() + 7) / 8); // round up to nearest byte
+  const unsigned words = (cols + 31) / 32; // WLEDMM each row starts at a new 32bit word
+  const size_t dataSize = words * rows * sizeof(uint32_t);
   const size_t detectionSize =  sizeof(uint16_t) * 3; // 2 CRCs, gliderLength
   const size_t totalSize = dataSize * 2 + detectionSize + sizeof(uint8_t); // detectionSize + prevPalette
 
   if (!SEGENV.allocateData(totalSize)) return mode_static(); //allocation failed
-  byte *cells       = reinterpret_cast<byte*>(SEGENV.data);
-  byte *futureCells = reinterpret_cast<byte*>(SEGENV.data + dataSize);
+  uint32_t *cells       = reinterpret_cast<uint32_t*>(SEGENV.data);
+  uint32_t *futureCells = reinterpret_cast<uint32_t*>(SEGENV.data + dataSize);
   uint16_t *gliderLength  = reinterpret_cast<uint16_t*>(SEGENV.data + dataSize * 2);
   uint16_t *oscillatorCRC = reinterpret_cast<uint16_t*>(SEGENV.data + dataSize * 2 + sizeof(uint16_t));
   uint16_t *spaceshipCRC  = reinterpret_cast<uint16_t*>(SEGENV.data + dataSize * 2 + sizeof(uint16_t) * 2);
@@ -5192,7 +5242,6 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
   byte bgBlur      = map(SEGMENT.custom1 - 220, 0, 35, 255, 128);
   uint32_t bgColor = SEGCOLOR(1);
   uint32_t color   = allColors ? random16() * random16() : SEGMENT.color_from_palette(0, false, PALETTE_SOLID_WRAP, 0);
-  uint16_t cIndex; 
 
   if (SEGENV.call == 0) {
     SEGMENT.setUpLeds();
@@ -5207,9 +5256,8 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
     //Setup Grid
     memset(cells, 0, dataSize);
     for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-      cIndex = y * cols + x;
       if (random8(100) < 32) { // ~32% chance of being alive
-        setBitValue(cells, cIndex, true);
+        golSet(cells, words, x, y);
         if (!overlayBG) SEGMENT.setPixelColorXY(x,y, bgColor); // Initial color set in redraw loop
       }
     }
@@ -5241,8 +5289,7 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
   // Always redraw dead cells if not overlaying background. Allows overlayFG by default.
   // Generation 1 draws alive cells randomly and fades dead cells
   for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-    cIndex = y * cols + x;
-    bool alive = getBitValue(cells, cIndex);
+    bool alive = golGet(cells, words, x, y);
     if (alive) aliveCount++;
     uint32_t cellColor = SEGMENT.getPixelColorXY(x,y);
     bool aliveBgColor = (alive && !overlayBG && generation == 1 && cellColor == bgColor);
@@ -5262,53 +5309,51 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
   if (SEGENV.step > strip.now || strip.now - SEGENV.step < 1000 / (uint32_t)map(SEGMENT.speed,0,255,1,64)) return FRAMETIME; //skip if not enough time has passed (1-64 updates/sec)
   
   //Update Game of Life
-  bool cellChanged = false; // Detect still live and dead grids
-  //cell coordinates
-  uint16_t cX;
-  uint16_t cY;
-  //Loop through all cells. Count neighbors, apply rules, setPixel
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-    byte neighbors = 0;
-    byte colorCount = 0; //track number of valid colors
-    uint32_t nColors[3]; // track 3 colors, dying cells may overwrite but this wont be used
-
-    for (int i = -1; i <= 1; i++) for (int j = -1; j <= 1; j++) { // iterate through 3*3 matrix
-      if (i == 0 && j == 0) continue; // ignore itself
-      if (!wrap || generation % 1500 == 0 || aliveCount == 5) { //no wrap, disable wrap every 1500 generations to prevent undetected repeats
-        cX = x + i;
-        cY = y + j;
-        if (cX < 0 || cY < 0 || cX >= cols || cY >= rows) continue; //skip if out of bounds
-      } else { //wrap around
-        cX = (x + i + cols) % cols;
-        cY = (y + j + rows) % rows;
-      }
-      cIndex = cY * cols + cX; //neighbor cell index
-      // count neighbors and store upto 3 neighbor colors
-      if (getBitValue(cells, cIndex)) { //if alive
-        neighbors++;
-        if (!getBitValue(futureCells, cIndex) || SEGMENT.getPixelColorXY(cX,cY) == bgColor) continue; //parent just died, color lost
-        color = SEGMENT.getPixelColorXY(cX, cY);
-        nColors[colorCount % 3] = color;
-        colorCount++;
-      }
-    }
+  // WLEDMM compute the next generation word-parallel, then only visit cells for coloring
+  const bool useWrap = wrap && !(generation % 1500 == 0 || aliveCount == 5); // disable wrap every 1500 generations to prevent undetected repeats
+  const bool cellChanged = golStep(cells, futureCells, cols, rows, useWrap); // Detect still live and dead grids
+  const uint32_t firstColor = color;
+
+  // neighbour in scan order (k = 0..7), false if outside of the grid
+  auto neighbour = [&](int x, int y, int k, int &cX, int &cY) -> bool {
+    const int i = (k < 3) ? -1 : (k < 5) ? 0 : 1;
+    const int j = (k < 3) ? k - 1 : (k < 5) ? ((k == 3) ? -1 : 1) : k - 6;
+    if (useWrap) { cX = (x + i + cols) % cols; cY = (y + j + rows) % rows; return true; }
+    cX = x + i; cY = y + j;
+    return (cX >= 0) && (cY >= 0) && (cX < cols) && (cY < rows);
+  };
+  // alive neighbour that still has its color when cell (x,y) is visited - cells are visited column by column
+  auto parentColor = [&](int x, int y, int cX, int cY, uint32_t &pColor) -> bool {
+    if (!golGet(cells, words, cX, cY)) return false;
+    bool visited = (cX < x) || (cX == x && cY < y);
+    if (visited && !golGet(futureCells, words, cX, cY)) return false; //parent just died, color lost
+    pColor = SEGMENT.getPixelColorXY(cX, cY);
+    return pColor != bgColor;
+  };
 
-    // Rules of Life
-    cIndex = y * cols + x; //current cell index
-    bool cellValue = getBitValue(cells, cIndex);
-    if ((cellValue) && (neighbors < 2 || neighbors > 3)) {
+  //Loop through all cells, apply rules to colors
+  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
+    bool cellValue = golGet(cells, words, x, y);
+    bool nextValue = golGet(futureCells, words, x, y);
+    if (cellValue && !nextValue) {
       // Loneliness or Overpopulation
-      cellChanged = true;
-      setBitValue(futureCells, cIndex, false);
       // Blur/turn off dying cells
       if (!overlayBG) SEGMENT.setPixelColorXY(x,y, color_blend(SEGMENT.getPixelColorXY(x,y), bgColor, bgBlendMode ? bgBlur : blur));
-    } 
-    else if (!(cellValue) && (neighbors == 3)) { 
+    }
+    else if (!cellValue && nextValue) {
       // Reproduction
-      setBitValue(futureCells, cIndex, true);
-      cellChanged = true;
+      // store upto 3 neighbor colors
+      byte colorCount = 0; //track number of valid colors
+      uint32_t nColors[3]; // track 3 colors, dying cells may overwrite but this wont be used
+      for (int k = 0; k < 8; k++) {
+        int cX, cY;
+        uint32_t pColor;
+        if (!neighbour(x, y, k, cX, cY) || !parentColor(x, y, cX, cY, pColor)) continue;
+        nColors[colorCount % 3] = pColor;
+        colorCount++;
+      }
       // find dominant color and assign it to a new born cell no longer storing colors, if parent dies the color is lost
-      uint32_t dominantColor; 
+      uint32_t dominantColor;
       if (colorCount == 3) { //All parents survived
         if ((nColors[0] == nColors[1]) || (nColors[0] == nColors[2])) dominantColor = nColors[0];
         else if (nColors[1] == nColors[2]) dominantColor = nColors[1];
@@ -5316,7 +5361,18 @@ uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https:
       }
       else if (colorCount == 2) dominantColor = nColors[random8(2)]; // 1 leading parent died
       else if (colorCount == 1) dominantColor = nColors[0];          // 2 leading parents died
-      else dominantColor = color;                                    // all parents died use last seen color
+      else { // all parents died use last seen color - the last valid neighbour of any cell visited before
+        dominantColor = firstColor;
+        bool found = false;
+        for (int p = x * rows + y - 1; p >= 0 && !found; p--) {
+          const int pX = p / rows, pY = p % rows;
+          for (int k = 7; k >= 0 && !found; k--) {
+            int cX, cY;
+            if (neighbour(pX, pY, k, cX, cY) && parentColor(pX, pY, cX, cY, dominantColor)) found = true;
+          }
+        }
+        if (!found) dominantColor = firstColor;
+      }
       // mutate color chance
       if (random8() < SEGMENT.intensity || dominantColor == bgColor) dominantColor = allColors ? random16() * random16() : SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 0);
       SEGMENT.setPixelColorXY(x,y, dominantColor);
@@ -5500,15 +5556,15 @@ uint16_t mode_2DLissajous(void) {            // By: Andrew Tuline
   
   uint_fast16_t phase = (strip.now * (1 + SEGENV.custom3)) /32;  // allow user to control rotation speed
 
-  if (SEGENV.check3) { // WLEDMM: this is the original "float" code featuring anti-aliasing
+  if (SEGENV.check3) { // WLEDMM: the original "float" code featuring anti-aliasing, now in Q8.8 fixed point
       int maxLoops = max(192, 4*(cols+rows));
       maxLoops = ((maxLoops / 128) +1) * 128; // make sure whe have half or full turns => multiples of 128
       for (int i=0; i < maxLoops; i ++) {
-        float xlocn = float(sin8(phase/2 + (i* SEGMENT.speed)/64)) / 255.0f;  // WLEDMM align speed with original effect
-        float ylocn = float(cos8(phase/2 + i*2)) / 255.0f;
-        //SEGMENT.setPixelColorXY(xlocn, ylocn, SEGMENT.color_from_palette(strip.now/100+i, false, PALETTE_SOLID_WRAP, 0)); // draw pixel with anti-aliasing
-        unsigned palIndex = (256*ylocn) + phase/2 + (i* SEGMENT.speed)/64;
-        SEGMENT.setPixelColorXY(xlocn, ylocn, SEGMENT.color_from_palette(palIndex, false, PALETTE_SOLID_WRAP, 0)); // draw pixel with anti-aliasing - color follows rotation
+        unsigned xlocn = sin8(phase/2 + (i* SEGMENT.speed)/64);  // WLEDMM align speed with original effect
+        unsigned ylocn = cos8(phase/2 + i*2);
+        unsigned palIndex = (256*ylocn)/255 + phase/2 + (i* SEGMENT.speed)/64;
+        SEGMENT.setPixelColorXYQ8((xlocn * (cols-1) * 256) / 255, (ylocn * (rows-1) * 256) / 255,
+                                  SEGMENT.color_from_palette(palIndex, false, PALETTE_SOLID_WRAP, 0)); // draw pixel with anti-aliasing - color follows rotation
       }
   } else
   for (int i=0; i < 256; i ++) {
@@ -6023,16 +6079,13 @@ uint16_t mode_2Dspaceships(void) {    //// Space ships by stepko (c)05.02.21 [ht
   SEGMENT.move(SEGENV.aux0, 1);
 
   for (size_t i = 0; i < 8; i++) {
-    byte x = beatsin8(12 + i, 2, cols - 3);
-    byte y = beatsin8(15 + i, 2, rows - 3);
-    CRGB color = ColorFromPalette(SEGPALETTE, beatsin8(12 + i, 0, 255), 255);
-    SEGMENT.addPixelColorXY(x, y, color);
-    if (cols > 24 || rows > 24) {
-      SEGMENT.addPixelColorXY(x+1, y, color);
-      SEGMENT.addPixelColorXY(x-1, y, color);
-      SEGMENT.addPixelColorXY(x, y+1, color);
-      SEGMENT.addPixelColorXY(x, y-1, color);
-    }
+    // WLEDMM sub-pixel positions (Q8.8), ships glide instead of jumping from pixel to pixel
+    int32_t x = beatsin16(12 + i, 2 << 8, (cols - 3) << 8);
+    int32_t y = beatsin16(15 + i, 2 << 8, (rows - 3) << 8);
+    CRGB c = ColorFromPalette(SEGPALETTE, beatsin8(12 + i, 0, 255), 255);
+    uint32_t color = RGBW32(c.r, c.g, c.b, 0);
+    SEGMENT.setPixelColorXYQ8(x, y, color, true);
+    if (cols > 24 || rows > 24) SEGMENT.drawCircleQ8(x, y, 256, color, true);  // 1 pixel radius: the 4 neighbours
   }
   SEGMENT.blur(SEGMENT.intensity>>3);
 
@@ -6093,10 +6146,8 @@ uint16_t mode_2Dcrazybees(void) {
     SEGMENT.fadeToBlackBy(32);
 
     for (size_t i = 0; i < n; i++) {
-      SEGMENT.addPixelColorXY(bee[i].aimX + 1, bee[i].aimY, CHSV(bee[i].hue, 255, 255));
-      SEGMENT.addPixelColorXY(bee[i].aimX, bee[i].aimY + 1, CHSV(bee[i].hue, 255, 255));
-      SEGMENT.addPixelColorXY(bee[i].aimX - 1, bee[i].aimY, CHSV(bee[i].hue, 255, 255));
-      SEGMENT.addPixelColorXY(bee[i].aimX, bee[i].aimY - 1, CHSV(bee[i].hue, 255, 255));
+      CRGB aim = CHSV(bee[i].hue, 255, 255);
+      SEGMENT.drawCircleQ8(bee[i].aimX << 8, bee[i].aimY << 8, 256, RGBW32(aim.r, aim.g, aim.b, 0), true); // WLEDMM target marker: the 4 neighbours of aim
       if (bee[i].posX != bee[i].aimX || bee[i].posY != bee[i].aimY) {
         SEGMENT.setPixelColorXY(bee[i].posX, bee[i].posY, CRGB(CHSV(bee[i].hue, 60, 255)));
         int_fast16_t error2 = bee[i].error * 2;
@@ -6173,8 +6224,10 @@ uint16_t mode_2Dghostrider(void) {
     CRGB color = CRGB::White;
     SEGMENT.wu_pixel(lighter->gPosX * 256 / 10, lighter->gPosY * 256 / 10, color);
 
-    lighter->gPosX += lighter->Vspeed * sinf(radians(lighter->gAngle));
-    lighter->gPosY += lighter->Vspeed * cosf(radians(lighter->gAngle));
+    // WLEDMM integer trig: degrees -> sin16 units, result scaled back from +-32767
+    uint16_t gAngle16 = (uint32_t(lighter->gAngle % 360) * 46603) >> 8;
+    lighter->gPosX += (lighter->Vspeed * sin16(gAngle16)) / 32768;
+    lighter->gPosY += (lighter->Vspeed * cos16(gAngle16)) / 32768;
     lighter->gAngle += lighter->angleSpeed;
     if (lighter->gPosX < 0)               lighter->gPosX = (cols - 1) * 10;
     if (lighter->gPosX > (cols - 1) * 10) lighter->gPosX = 0;
@@ -6196,8 +6249,9 @@ uint16_t mode_2Dghostrider(void) {
         lighter->time[i] = 0;
         lighter->reg[i] = false;
       } else {
-        lighter->lightersPosX[i] += -7 * sinf(radians(lighter->Angle[i]));
-        lighter->lightersPosY[i] += -7 * cosf(radians(lighter->Angle[i]));
+        uint16_t angle16 = (uint32_t(lighter->Angle[i] % 360) * 46603) >> 8;
+        lighter->lightersPosX[i] += (-7 * sin16(angle16)) / 32768;
+        lighter->lightersPosY[i] += (-7 * cos16(angle16)) / 32768;
       }
       SEGMENT.wu_pixel(lighter->lightersPosX[i] * 256 / 10, lighter->lightersPosY[i] * 256 / 10, ColorFromPalette(SEGPALETTE, (256 - lighter->time[i])));
     }
@@ -6372,14 +6426,15 @@ uint16_t mode_2Dscrollingtext(void) {
         SEGMENT.blendPixelColorXY(x, y, SEGCOLOR(1), 255 - (SEGMENT.custom1>>1));
     }
   }
+  uint32_t col1 = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0); // WLEDMM same for all letters
+  uint32_t col2 = BLACK;
+  if (SEGMENT.check1 && SEGMENT.palette == 0) {
+    col1 = SEGCOLOR(0);
+    col2 = SEGCOLOR(2);
+  }
   for (int i = 0; i < numberOfLetters; i++) {
     if (int(cols) - int(SEGENV.aux0) + letterWidth*(i+1) < 0) continue; // don't draw characters off-screen
-    uint32_t col1 = SEGMENT.color_from_palette(SEGENV.aux1, false, PALETTE_SOLID_WRAP, 0);
-    uint32_t col2 = BLACK;
-    if (SEGMENT.check1 && SEGMENT.palette == 0) {
-      col1 = SEGCOLOR(0);
-      col2 = SEGCOLOR(2);
-    }
+    if (int(cols) - int(SEGENV.aux0) + letterWidth*i >= int(cols)) break; // WLEDMM remaining characters are off-screen, too
     SEGMENT.drawCharacter(text[i], int(cols) - int(SEGENV.aux0) + letterWidth*i, yoffset, letterWidth, letterHeight, col1, col2);
   }
 
@@ -6398,9 +6453,10 @@ uint16_t mode_2Ddriftrose(void) {
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
 
-  const float CX = (cols-cols%2)/2.f - .5f;
-  const float CY = (rows-rows%2)/2.f - .5f;
-  const float L = min(cols, rows) / 2.f;
+  // WLEDMM Q8.8 fixed point
+  const int32_t CX = ((cols-cols%2) << 7) - 128;
+  const int32_t CY = ((rows-rows%2) << 7) - 128;
+  const int32_t L2 = min(cols, rows);  // 2 * L
 
   if (SEGENV.call == 0) {
     SEGMENT.setUpLeds();
@@ -6409,8 +6465,10 @@ uint16_t mode_2Ddriftrose(void) {
 
   SEGMENT.fadeToBlackBy(32+(SEGMENT.speed>>3));
   for (size_t i = 1; i < 37; i++) {
-    uint32_t x = (CX + (sinf(radians(i * 10)) * (beatsin8(i, 0, L*2)-L))) * 255.f;
-    uint32_t y = (CY + (cosf(radians(i * 10)) * (beatsin8(i, 0, L*2)-L))) * 255.f;
+    uint16_t angle = (i * 10 * 46603) >> 8;                  // degrees -> sin16 units
+    int32_t r = (int32_t(beatsin16(i, 0, L2)) << 8) - (L2 << 7); // Q8.8, beatsin16 as L2 may exceed 255
+    int32_t x = CX + (((sin16(angle) >> 4) * r) >> 11);          // sine cut to 12 bits keeps the product in int32
+    int32_t y = CY + (((cos16(angle) >> 4) * r) >> 11);
     SEGMENT.wu_pixel(x, y, CHSV(i * 10, 255, 255));
   }
   SEGMENT.blur((SEGMENT.intensity>>4)+1);
@@ -8269,18 +8327,6 @@ uint16_t mode_2Doctopus() {
   const uint16_t rows = SEGMENT.virtualHeight();
   const uint8_t mapp = 180 / MAX(cols,rows);
 
-  typedef struct {
-    uint8_t angle;
-    uint8_t radius;
-  } map_t;
-
-  const size_t dataSize = SEGMENT.width() * SEGMENT.height() * sizeof(map_t); // prevent reallocation if mirrored or grouped
-  if (!SEGENV.allocateData(dataSize + 2)) return mode_static(); //allocation failed
-
-  map_t *rMap = reinterpret_cast<map_t*>(SEGENV.data);
-  uint8_t *offsX = reinterpret_cast<uint8_t*>(SEGENV.data + dataSize);
-  uint8_t *offsY = reinterpret_cast<uint8_t*>(SEGENV.data + dataSize + 1);
-
   //WLEDMM add SuperSync control
   uint16_t xStart, xEnd, yStart, yEnd;
   if (SEGMENT.check1) { //Master (sync on needs to show the whole effect, children only their first panel)
@@ -8296,23 +8342,10 @@ uint16_t mode_2Doctopus() {
     yEnd = rows;
   }
 
-  // re-init if SEGMENT dimensions or offset changed
-  if (SEGENV.call == 0 || SEGENV.aux0 != cols || SEGENV.aux1 != rows || SEGMENT.custom1 != *offsX || SEGMENT.custom2 != *offsY) {
-    if (!true) //WLEDMM SuperSync
-      SEGENV.step = 0; // t
-    SEGENV.aux0 = cols;
-    SEGENV.aux1 = rows;
-    *offsX = SEGMENT.custom1;
-    *offsY = SEGMENT.custom2;
-    const uint8_t C_X = cols / 2 + (SEGMENT.custom1 - 128)*cols/255;
-    const uint8_t C_Y = rows / 2 + (SEGMENT.custom2 - 128)*rows/255;
-    for (int x = xStart; x < xEnd; x++) {
-      for (int y = yStart; y < yEnd; y++) {
-        rMap[XY(x, y)].angle = 40.7436f * atan2f(y - C_Y, x - C_X); // avoid 128*atan2()/PI
-        rMap[XY(x, y)].radius = hypotf(x - C_X, y - C_Y) * mapp; //thanks Sutaburosu
-      }
-    }
-  }
+  // WLEDMM angle and radius come from the shared polar table (rebuilt by strip when size or offset changes)
+  const uint8_t C_X = cols / 2 + (SEGMENT.custom1 - 128)*cols/255;
+  const uint8_t C_Y = rows / 2 + (SEGMENT.custom2 - 128)*rows/255;
+  const polar_map_t *pMap = strip.getPolarMap(cols, rows, C_X, C_Y);
 
   if (true) // WLEDMM SuperSync
     SEGENV.step = strip.now * (SEGMENT.speed / 32 + 1) / 25;  // WLEDMM 40fps
@@ -8321,8 +8354,15 @@ uint16_t mode_2Doctopus() {
 
   for (int x = xStart; x < xEnd; x++) {
     for (int y = yStart; y < yEnd; y++) {
-      byte angle = rMap[XY(x,y)].angle;
-      byte radius = rMap[XY(x,y)].radius;
+      byte angle, radius;
+      if (pMap) {
+        const polar_px_t &p = pMap->px[XY(x,y)];
+        angle  = p.angle >> 8;
+        radius = (uint32_t(p.radius) * mapp) >> 8;
+      } else { // no table available (low memory)
+        angle  = 40.7436f * atan2f(y - C_Y, x - C_X); // avoid 128*atan2()/PI
+        radius = hypotf(x - C_X, y - C_Y) * mapp; //thanks Sutaburosu
+      }
       //CRGB c = CHSV(SEGENV.step / 2 - radius, 255, sin8(sin8((angle * 4 - radius) / 4 + SEGENV.step) + radius - SEGENV.step * 2 + angle * (SEGMENT.custom3/3+1)));
       uint16_t intensity = sin8(sin8((angle * 4 - radius) / 4 + SEGENV.step/2) + radius - SEGENV.step + angle * (SEGMENT.custom3/4+1));
       intensity = map(intensity*intensity, 0, 65535, 0, 255); // add a bit of non-linearity for cleaner display
@@ -60,6 +60,13 @@ bool strip_uses_global_leds(void);              // WLEDMM implemented in FX_fcn.
 #define RGBW32(r,g,b,w) (uint32_t((byte(w) << 24) | (byte(r) << 16) | (byte(g) << 8) | (byte(b))))
 #endif
 
+// WLEDMM pipelined render/transmit (ESP32 and host build): instead of blocking in show() while the previous frame is still on the wire,
+// a finished frame is parked in the bus back buffers until the busses are idle, and the next frame is rendered while it is being sent.
+// Needs WLEDMM_BUS_BUFFER (bus_manager.h): the bus buffer is the back buffer.
+#if defined(WLEDMM_PIPELINE_SHOW) && !defined(ARDUINO_ARCH_ESP32) && !defined(WLED_NATIVE)
+  #undef WLEDMM_PIPELINE_SHOW
+#endif
+
 /* Not used in all effects yet */
 #if defined(ARDUINO_ARCH_ESP32) && defined(WLEDMM_FASTPATH)   // WLEDMM go faster on ESP32
 #define WLED_FPS         120
@@ -107,7 +114,7 @@ bool strip_uses_global_leds(void);              // WLEDMM implemented in FX_fcn.
 //#define SEGLEN           strip._segments[strip.getCurrSegmentId()].virtualLength()
 #define SEGCOLOR(x)      strip.segColor(x) /* saves us a few kbytes of code */
 #define SEGPALETTE       Segment::getCurrentPalette()
-#define SEGLEN           strip._virtualSegmentLength /* saves us a few kbytes of code */
+#define SEGLEN           strip._fxCtx[FX_WORKER_ID].virtualLength /* saves us a few kbytes of code */
 #define SPEED_FORMULA_L  (5U + (50U*(255U - SEGMENT.speed))/SEGLEN)
 
 // some common colors
@@ -358,7 +365,96 @@ typedef enum mapping1D2D {
   M12_sPinwheel = 7 //WLEDMM Pinwheel
 } mapping1D2D_t;
 
-// segment, 72 bytes
+// WLEDMM ledmap classification (WS2812FX::classifyMapping()) - regular layouts are computed instead of looked up
+#define MAPPING_ARBITRARY    0 // customMappingTable lookup
+#define MAPPING_IDENTITY     1 // table is 1:1, no lookup needed
+#define MAPPING_AFFINE       2 // phys = base + x*dx + y*dy (single panel, any start corner / orientation)
+#define MAPPING_SERPENTINE   3 // same, but every odd row runs backwards
+#define MAPPING_SERPENTINE_V 4 // same, but every odd column runs backwards
+
+// WLEDMM span writes (setPixelColors) are processed in stack chunks of this many pixels
+#ifndef PIXEL_SPAN_CHUNK
+  #define PIXEL_SPAN_CHUNK 64
+#endif
+
+// WLEDMM precomputed "virtual index -> physical indices" table for 1D segments (costs 2 bytes per physical pixel)
+#if !defined(ESP8266) && !defined(WLEDMM_NO_SEGMENT_PIXELMAP)
+  #define WLEDMM_SEGMENT_PIXELMAP
+#endif
+
+// WLEDMM geometry snapshot + index table, built by Segment::updatePixelMap()
+typedef struct SegmentPixelMap {
+  uint32_t generation;  // Segment::_pixelMapGeneration at build time (ledmap/bus changes) - 32 bit, so it never wraps back to a stale table
+  uint16_t start;       // segment geometry the table was built for
+  uint16_t stop;
+  uint16_t offset;
+  uint8_t  grouping;
+  uint8_t  spacing;
+  uint8_t  flags;       // REVERSE | MIRROR bits of segment options
+  uint16_t stride;      // physical indices per virtual pixel (grouping, x2 if mirrored)
+  uint16_t vLength;     // number of virtual pixels
+  uint16_t index[];     // vLength*stride physical (bus) indices; 0xFFFF = no pixel
+} seg_pixelmap_t;
+
+// WLEDMM precompiled 1D->2D expansion for the pArc, sCircle, sBlock and sPinwheel mappings (ESP32 only, costs 4 bytes per cell)
+#if !defined(ESP8266) && !defined(WLED_DISABLE_2D) && !defined(WLEDMM_NO_SEGMENT_XYLIST)
+  #define WLEDMM_SEGMENT_XYLIST
+  #ifndef XYLIST_MAX_CELLS
+    #define XYLIST_MAX_CELLS 8192  // larger expansions are not cached (-> 32KB)
+  #endif
+#endif
+
+// WLEDMM virtual index -> run of XY cells, built by Segment::updateXYList()
+typedef struct SegmentXYList {
+  uint16_t width;       // virtualWidth() / virtualHeight() the list was built for
+  uint16_t height;
+  uint8_t  map1D2D;     // mapping the list was built for
+  uint16_t vLength;     // number of virtual pixels
+  uint16_t numCells;    // total number of cells
+  uint16_t data[];      // vLength+1 run offsets, vLength center skips (pinwheel), followed by numCells (x,y) pairs
+} seg_xylist_t;
+
+// WLEDMM per-segment cache of the fully expanded 256-entry palette, turns color_from_palette() into a single array read (costs ~1.1KB per segment)
+#if !defined(ESP8266) && !defined(WLEDMM_NO_PALETTE_CACHE)
+  #define WLEDMM_PALETTE_CACHE
+#endif
+
+// WLEDMM palette cache, maintained by Segment::setCurrentPalette()
+typedef struct SegmentPaletteCache {
+  CRGBPalette16 pal16;          // 16-entry palette the table was expanded from
+  uint32_t colors[NUM_COLORS];  // gamma corrected segment colors (palettes 2-5, and palette 0 of some effects, are built from them)
+  uint16_t generation;          // Segment::_paletteGeneration at build time (custom palettes reloaded)
+  uint8_t  palette;             // palette ID
+  uint8_t  mode;                // effect ID (default palette depends on it)
+  bool     noBlend;             // strip.paletteBlend == 3
+  bool     valid;               // entries[] matches pal16
+  uint32_t entries[256];        // ColorFromPalette(pal16, i, 255, blend) as RGBW32
+} seg_palcache_t;
+
+// WLEDMM shared polar coordinate tables for 2D effects, see WS2812FX::getPolarMap()
+#ifndef POLAR_MAP_SLOTS
+  #define POLAR_MAP_SLOTS 2     // number of different geometries / centers kept at the same time
+#endif
+#ifndef RENDER_BUFFER_TIMEOUT
+  #define RENDER_BUFFER_TIMEOUT 2000 // ms - shared render buffers (polar tables, blur2D scratch) not used for this long are freed
+#endif
+
+typedef struct PolarPixel {
+  uint16_t angle;               // atan2(y-cy, x-cx); full circle = 65536, so angle >> 8 is a FastLED style angle8
+  uint16_t radius;              // distance from center in 8.8 fixed point (saturates at 255.99 pixels)
+} polar_px_t;
+
+typedef struct PolarMap {
+  uint16_t cols;                // grid size
+  uint16_t rows;
+  int16_t  cx;                  // center
+  int16_t  cy;
+  unsigned long lastUsed;       // strip.now of the last frame that requested it
+  bool     ready;               // px[] is filled
+  polar_px_t px[];              // cols*rows entries, index = x + y*cols (same as Segment::XY())
+} polar_map_t;
+
+// segment, 76 bytes
 typedef struct Segment {
   public:
     uint16_t start; // start index / start X coordinate 2D (left)
@@ -397,8 +493,8 @@ typedef struct Segment {
       bool    check2  : 1;        // checkmark 2
       bool    check3  : 1;        // checkmark 3
     };
-    uint8_t startY;  // start Y coodrinate 2D (top); there should be no more than 255 rows
-    uint8_t stopY;   // stop Y coordinate 2D (bottom); there should be no more than 255 rows
+    uint16_t startY; // start Y coodrinate 2D (top) // WLEDMM 16 bit for very large matrices (fills former padding, segment size unchanged)
+    uint16_t stopY;  // stop Y coordinate 2D (bottom)
     char *name = nullptr; // WLEDMM initialize to nullptr
 
     // runtime data
@@ -428,8 +524,15 @@ typedef struct Segment {
     size_t _dataLen;                   // WLEDMM uint16_t is too small
     static size_t _usedSegmentData;    // WLEDMM uint16_t is too small
 
+    seg_pixelmap_t *_pixelMap;          // WLEDMM precomputed physical indices for 1D setPixelColor()
+    static uint32_t _pixelMapGeneration; // WLEDMM incremented whenever ledmap or busses change
+    seg_palcache_t *_palCache;          // WLEDMM expanded palette for color_from_palette()
+    seg_xylist_t   *_xyList;            // WLEDMM precompiled 1D->2D expansion for setPixelColor()
+    int16_t         _prevRay;           // WLEDMM last pinwheel ray drawn; an odd ray next to it starts further from the center
+    static uint16_t _paletteGeneration;  // WLEDMM incremented whenever custom palettes are reloaded
+
     // perhaps this should be per segment, not static
-    static CRGBPalette16 _currentPalette;     // palette used for current effect (includes transition, used in color_from_palette())
+    static CRGBPalette16 _currentPalette[WLED_RENDER_WORKERS]; // palette used for current effect (includes transition, used in color_from_palette()), one per render worker
 
     // transition data, valid only if transitional==true, holds values during transition
     struct Transition {
@@ -501,6 +604,10 @@ typedef struct Segment {
       ledsrgbSize(0), //WLEDMM
       _capabilities(0),
       _dataLen(0),
+      _pixelMap(nullptr),
+      _palCache(nullptr),
+      _xyList(nullptr),
+      _prevRay(INT16_MIN),
       _t(nullptr)
     {
       //refreshLightCapabilities();
@@ -538,6 +645,9 @@ typedef struct Segment {
       if (name) { delete[] name; name = nullptr; }
       if (_t)   { transitional = false; delete _t; _t = nullptr; }
       deallocateData();
+      deletePixelMap(); // WLEDMM
+      deletePaletteCache(); // WLEDMM
+      deleteXYList(); // WLEDMM
     }
 
     Segment& operator= (const Segment &orig); // copy assignment
@@ -561,10 +671,10 @@ typedef struct Segment {
     inline uint8_t  getLightCapabilities(void) const { return _capabilities; }
 
     static size_t   getUsedSegmentData(void)    { return _usedSegmentData; } // WLEDMM size_t
-    static void     addUsedSegmentData(int len) { _usedSegmentData += len; }
+    static void     addUsedSegmentData(int len);
 
     void    allocLeds(); //WLEDMM
-    inline static const CRGBPalette16 &getCurrentPalette(void) { return Segment::_currentPalette; }
+    inline static const CRGBPalette16 &getCurrentPalette(void) { return Segment::_currentPalette[FX_WORKER_ID]; }
 
     void    setUp(uint16_t i1, uint16_t i2, uint8_t grp=1, uint8_t spc=0, uint16_t ofs=UINT16_MAX, uint16_t i1Y=0, uint16_t i2Y=1);
     bool    setColor(uint8_t slot, uint32_t c); //returns true if changed
@@ -590,6 +700,32 @@ typedef struct Segment {
     inline void markForReset(void) { reset = true; }  // setOption(SEG_OPTION_RESET, true)
     void setUpLeds(void);   // set up leds[] array for loseless getPixelColor()
 
+    // WLEDMM 1D pixel index table; rebuilt by strip.service() whenever segment geometry changed
+    void updatePixelMap(void);
+    void deletePixelMap(void) { if (_pixelMap) free(_pixelMap); _pixelMap = nullptr; }
+    inline static void invalidatePixelMaps(void) { _pixelMapGeneration++; } // call after ledmap or bus changes
+    // WLEDMM expanded palette; refreshed by setCurrentPalette()
+    void deletePaletteCache(void) { if (_palCache) free(_palCache); _palCache = nullptr; }
+    inline static void invalidatePaletteCaches(void) { _paletteGeneration++; } // call after custom palettes changed
+    // WLEDMM 1D->2D expansion lists; rebuilt by strip.service() whenever virtual size or mapping changed
+    void updateXYList(void);
+    void deleteXYList(void) { if (_xyList) free(_xyList); _xyList = nullptr; }
+    inline bool xyListValid(void) const {
+      return _xyList && (_xyList->map1D2D == map1D2D) && (_xyList->width == virtualWidth()) && (_xyList->height == virtualHeight());
+    }
+    // WLEDMM pinwheel: an odd ray drawn right after its neighbour starts further from the center, the neighbour already covers it
+    inline bool pinwheelSkipsCenter(int ray) {
+      const bool skip = (ray % 2 == 1) && ((ray - 1 == _prevRay) || (ray + 1 == _prevRay));
+      _prevRay = ray;
+      return skip;
+    }
+    inline bool pixelMapValid(void) const {
+      return _pixelMap && (_pixelMap->generation == _pixelMapGeneration)
+          && (_pixelMap->start == start) && (_pixelMap->stop == stop) && (_pixelMap->offset == offset)
+          && (_pixelMap->grouping == grouping) && (_pixelMap->spacing == spacing)
+          && (_pixelMap->flags == (options & (REVERSE | MIRROR)));
+    }
+
     // transition functions
     void     startTransition(uint16_t dur); // transition has to start before actual segment values change
     void     handleTransition(void);
@@ -610,6 +746,7 @@ typedef struct Segment {
     uint32_t currentColor(uint8_t slot, uint32_t colorNew);
     CRGBPalette16 &loadPalette(CRGBPalette16 &tgt, uint8_t pal);
     void     setCurrentPalette(void);
+    void     updatePaletteCache(const CRGBPalette16 &pal, const uint32_t *gColors, bool noBlend, bool volatilePal); // WLEDMM
 
     // 1D strip
     uint16_t virtualLength(void) const;
@@ -619,6 +756,7 @@ typedef struct Segment {
     void setPixelColor(float i, uint32_t c, bool aa = true);
     void setPixelColor(float i, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0, bool aa = true) { setPixelColor(i, RGBW32(r,g,b,w), aa); }
     void setPixelColor(float i, CRGB c, bool aa = true)                                         { setPixelColor(i, RGBW32(c.r,c.g,c.b,0), aa); }
+    void setPixelColors(int first, const uint32_t *c, unsigned n); // WLEDMM set n consecutive pixels, same result as n calls to setPixelColor()
     uint32_t __attribute__((pure)) getPixelColor(int i);  // WLEDMM attribute added
     // 1D support functions (some implement 2D as well)
     void blur(uint8_t, bool smear = false);
@@ -681,6 +819,7 @@ typedef struct Segment {
     void box_blur(uint16_t i, bool vertical, fract8 blur_amount); // 1D box blur (with weight)
     void blurRow(uint32_t row, fract8 blur_amount, bool smear = false);
     void blurCol(uint32_t col, fract8 blur_amount, bool smear = false);
+    void blur2D(fract8 blur_amount, bool smear = false); // WLEDMM all rows + all columns on a pixel buffer, one write-back
     void moveX(int8_t delta, bool wrap = false);
     void moveY(int8_t delta, bool wrap = false);
     void move(uint8_t dir, uint8_t delta, bool wrap = false);
@@ -692,7 +831,11 @@ typedef struct Segment {
     void drawArc(uint16_t x0, uint16_t y0, uint16_t radius, CRGB color, CRGB fillColor = BLACK) { drawArc(x0, y0, radius, RGBW32(color.r,color.g,color.b,0), RGBW32(fillColor.r,fillColor.g,fillColor.b,0)); } // automatic inline
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t col2 = 0);
     void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c, CRGB c2) { drawCharacter(chr, x, y, w, h, RGBW32(c.r,c.g,c.b,0), RGBW32(c2.r,c2.g,c2.b,0)); } // automatic inline
-    void wu_pixel(uint32_t x, uint32_t y, CRGB c);
+    void wu_pixel(uint32_t x, uint32_t y, CRGB c) { setPixelColorXYQ8(int32_t(x), int32_t(y), RGBW32(c.r,c.g,c.b,0), true); } // automatic inline
+    // WLEDMM Q8.8 sub-pixel drawing (coordinates in 1/256 pixel), integer-only Wu kernel; add = true adds light instead of blending
+    void setPixelColorXYQ8(int32_t x, int32_t y, uint32_t c, bool add = false);
+    void drawLineQ8(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t c, bool add = false);
+    void drawCircleQ8(int32_t cx, int32_t cy, int32_t radius, uint32_t c, bool add = false);
     void blur1d(fract8 blur_amount); // blur all rows in 1 dimension
     void blur2d(fract8 blur_amount) { blur(blur_amount); }
     void fill_solid(CRGB c) { fill(RGBW32(c.r,c.g,c.b,0)); }
@@ -719,6 +862,7 @@ typedef struct Segment {
     inline void box_blur(uint16_t i, bool vertical, fract8 blur_amount) {}
     inline void blurRow(uint32_t row, fract8 blur_amount, bool smear = false) {}
     inline void blurCol(uint32_t col, fract8 blur_amount, bool smear = false) {}
+    inline void blur2D(fract8 blur_amount, bool smear = false) {}
     inline void moveX(int8_t delta, bool wrap = false) {}
     inline void moveY(int8_t delta, bool wrap = false) {}
     inline void move(uint8_t dir, uint8_t delta, bool wrap = false) {}
@@ -729,11 +873,34 @@ typedef struct Segment {
     inline void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB color) {}
     inline void drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, CRGB c, CRGB c2, int8_t rotate = 0) {}
     inline void wu_pixel(uint32_t x, uint32_t y, CRGB c) {}
+    inline void setPixelColorXYQ8(int32_t x, int32_t y, uint32_t c, bool add = false) {}
+    inline void drawLineQ8(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t c, bool add = false) {}
+    inline void drawCircleQ8(int32_t cx, int32_t cy, int32_t radius, uint32_t c, bool add = false) {}
   #endif
   uint8_t * getAudioPalette(int pal); //WLEDMM netmindz ar palette
 } segment;
 //static int segSize = sizeof(Segment);
 
+// WLEDMM frame time profiler for effects, show(), ABL and overlays - fixed size histograms, no allocations
+#if !defined(ESP8266) && !defined(WLEDMM_NO_PROFILER)
+  #define WLEDMM_PROFILER
+#endif
+#ifdef WLEDMM_PROFILER
+#define PROF_BINS 32 // two bins per octave, 1us ... 65ms (the last bin catches everything above)
+typedef struct FrameTimeStats {
+  uint64_t sum;              // sum of all samples (us)
+  uint32_t minUs, maxUs;     // extreme samples
+  uint16_t count;            // number of samples, histogram is halved when it gets large
+  uint8_t  fx;               // effect the samples belong to (segment stats only)
+  uint16_t hist[PROF_BINS];
+
+  void reset(uint8_t mode = 0) { memset(this, 0, sizeof(FrameTimeStats)); minUs = UINT32_MAX; fx = mode; }
+  void add(uint32_t us);
+  inline uint32_t avg(void) const { return count ? sum / count : 0; }
+  uint32_t percentile(uint8_t p) const;
+} frametime_stats_t;
+#endif
+
 // main "strip" class
 class WS2812FX {  // 96 bytes
   typedef uint16_t (*mode_ptr)(void); // pointer to mode function
@@ -763,8 +930,7 @@ class WS2812FX {  // 96 bytes
       panels(1),
 #endif
       // semi-private (just obscured) used in effect functions through macros
-      _colors_t{0,0,0},
-      _virtualSegmentLength(0),
+      _fxCtx{},
       // true private variables
       _length(DEFAULT_LED_COUNT),
       _brightness(DEFAULT_BRIGHTNESS),
@@ -780,13 +946,13 @@ class WS2812FX {  // 96 bytes
       _isOffRefreshRequired(false),
       _hasWhiteChannel(false),
       _triggered(false),
+      _framePending(false),
       _modeCount(MODE_COUNT),
       _callback(nullptr),
       customMappingTable(nullptr),
       customMappingTableSize(0), //WLEDMM
       customMappingSize(0),
       _lastShow(0),
-      _segment_index(0),
       _mainSegment(0)
     {
       WS2812FX::instance = this;
@@ -801,6 +967,7 @@ class WS2812FX {  // 96 bytes
       if (Serial) Serial.println(F("~WS2812FX destroying strip.")); // WLEDMM can't use DEBUG_PRINTLN here
       #endif
       if (customMappingTable) delete[] customMappingTable;
+      purgePolarMaps(); // WLEDMM
       _mode.clear();
       _modeData.clear();
       _segments.clear();
@@ -846,6 +1013,11 @@ class WS2812FX {  // 96 bytes
     // outsmart the compiler :) by correctly overloading
     inline void setPixelColor(int n, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) { setPixelColor(n, RGBW32(r,g,b,w)); }
     inline void setPixelColor(int n, CRGB c) { setPixelColor(n, c.red, c.green, c.blue); }
+    void setPixelColors(int start, const uint32_t *c, unsigned n); // WLEDMM set n consecutive pixels (ledmap aware)
+    const polar_map_t* getPolarMap(uint16_t cols, uint16_t rows, int16_t cx, int16_t cy); // WLEDMM shared angle/radius table, nullptr if not available
+    void purgePolarMaps(void); // WLEDMM release all polar tables
+    void purgeIdleBuffers(void); // WLEDMM release shared render buffers that no effect has used for RENDER_BUFFER_TIMEOUT
+    inline uint16_t getMappedPixelIndex(uint16_t index) const { return (index < customMappingSize && customMappingType != MAPPING_IDENTITY) ? customMappingTable[index] : index; } // WLEDMM ledmap lookup
     inline void trigger(void) { _triggered = true; } // Forces the next frame to be computed on all active segments.
     inline void setShowCallback(show_callback cb) { _callback = cb; }
     inline void setTransition(uint16_t t) { _transitionDur = t; }
@@ -861,6 +1033,7 @@ class WS2812FX {  // 96 bytes
       useLedsArray = false;
 
     inline bool isServicing(void) { return _isServicing; }
+    inline bool isFramePending(void) { return _framePending; } // WLEDMM pipelined show
     inline bool hasWhiteChannel(void) {return _hasWhiteChannel;}
     inline bool isOffRefreshRequired(void) {return _isOffRefreshRequired;}
 
@@ -878,12 +1051,21 @@ class WS2812FX {  // 96 bytes
     inline uint8_t getBrightness(void) { return _brightness; }
     inline uint8_t getMaxSegments(void) { return MAX_NUM_SEGMENTS; }  // returns maximum number of supported segments (fixed value)
     inline uint8_t getSegmentsNum(void) { return _segments.size(); }  // returns currently present segments
-    inline uint8_t getCurrSegmentId(void) { return _segment_index; }
+    inline uint8_t getCurrSegmentId(void) { return _fxCtx[FX_WORKER_ID].segIndex; }
     inline uint8_t getMainSegmentId(void) { return _mainSegment; }
     inline uint8_t getPaletteCount() { return 13 + GRADIENT_PALETTE_COUNT; }  // will only return built-in palette count
     inline uint8_t getTargetFps() { return _targetFps; }
     inline uint8_t getModeCount() { return _modeCount; }
 
+#ifdef WLEDMM_PROFILER
+    // WLEDMM frame time statistics, see /json/info "prof"
+    frametime_stats_t
+      profSeg[MAX_NUM_SEGMENTS], // effect function, per segment
+      profShow,                  // busses.show()
+      profAbl,                   // estimateCurrentAndLimitBri()
+      profOverlay;               // usermod overlays (show callback)
+#endif
+
     uint16_t
       ablMilliampsMax,
       currentMilliamps,
@@ -902,7 +1084,7 @@ class WS2812FX {  // 96 bytes
     uint32_t __attribute__((pure)) getPixelColor(uint_fast16_t);   // WLEDMM attribute pure = does not have side-effects
 
     inline uint32_t getLastShow(void) { return _lastShow; }
-    inline uint32_t segColor(uint8_t i) { return _colors_t[i]; }
+    inline uint32_t segColor(uint8_t i) { return _fxCtx[FX_WORKER_ID].colors[i]; }
 
     const char *
       getModeData(uint8_t id = 0) { return (id && id<_modeCount) ? _modeData[id] : PSTR("Solid"); }
@@ -943,10 +1125,10 @@ class WS2812FX {  // 96 bytes
     } panelO; //panelOrientation
 
     typedef struct panel_t {
-      uint8_t xOffset; // x offset relative to the top left of matrix in LEDs. WLEDMM 8 bits/256 is enough
-      uint8_t yOffset; // y offset relative to the top left of matrix in LEDs. WLEDMM 8 bits/256 is enough
-      uint8_t  width;   // width of the panel
-      uint8_t  height;  // height of the panel
+      uint16_t xOffset; // x offset relative to the top left of matrix in LEDs. WLEDMM 16 bits for LED walls (HUB75 chains) beyond 255 pixels
+      uint16_t yOffset; // y offset relative to the top left of matrix in LEDs
+      uint16_t width;   // width of the panel
+      uint16_t height;  // height of the panel
       union {
         uint8_t options;
         struct {
@@ -985,8 +1167,12 @@ class WS2812FX {  // 96 bytes
 
     // using public variables to reduce code size increase due to inline function getSegment() (with bounds checking)
     // and color transitions
-    uint32_t _colors_t[3]; // color used for effect (includes transition)
-    uint16_t _virtualSegmentLength;
+    // WLEDMM effect context, one per render worker (FX_WORKER_ID)
+    struct {
+      uint32_t colors[3];      // color used for effect (includes transition)
+      uint16_t virtualLength;  // SEGLEN
+      uint8_t  segIndex;       // SEGMENT, SEGENV
+    } _fxCtx[WLED_RENDER_WORKERS];
 
     std::vector<segment> _segments;
     friend class Segment;
@@ -1010,6 +1196,7 @@ class WS2812FX {  // 96 bytes
       bool _isOffRefreshRequired : 1; //periodic refresh is required for the strip to remain off.
       bool _hasWhiteChannel      : 1;
       bool _triggered            : 1;
+      bool _framePending         : 1; // WLEDMM pipelined show: frame is rendered, but not handed over to the busses yet
     };
 
     uint8_t                  _modeCount;
@@ -1021,14 +1208,43 @@ class WS2812FX {  // 96 bytes
     uint16_t* customMappingTable;
     uint16_t  customMappingTableSize; //WLEDMM
     uint16_t  customMappingSize;
+    uint8_t   customMappingType = MAPPING_ARBITRARY; // WLEDMM access path for customMappingTable, see classifyMapping()
+    uint16_t  _mapWidth = 0, _mapHeight = 0;         // WLEDMM matrix size the mapping was classified for
+    int32_t   _mapBase = 0, _mapDX = 1, _mapDY = 0;  // WLEDMM parameters of affine / serpentine mappings
+
+    void classifyMapping(void); // WLEDMM detect identity / affine / serpentine ledmaps
+
+    // WLEDMM physical index of matrix pixel (x,y) - computed for regular layouts, table lookup otherwise. index = y * Segment::maxWidth + x
+    inline uint_fast16_t mapPixelXY(int x, int y, uint_fast16_t index) const {
+      if (customMappingType == MAPPING_IDENTITY) return index;
+      if ((customMappingType == MAPPING_ARBITRARY) || (unsigned(x) >= _mapWidth) || (_mapWidth != Segment::maxWidth)) return customMappingTable[index];
+      if ((customMappingType == MAPPING_SERPENTINE) && (y & 1)) x = _mapWidth - 1 - x;
+      if ((customMappingType == MAPPING_SERPENTINE_V) && (x & 1)) y = _mapHeight - 1 - y;
+      return uint16_t(_mapBase + x * _mapDX + y * _mapDY);
+    }
 
     /*uint32_t*/ unsigned long _lastShow; // WLEDMM avoid losing precision
 
-    uint8_t _segment_index;
     uint8_t _mainSegment;
 
     void
       estimateCurrentAndLimitBri(void);
+
+    uint16_t renderSegment(Segment &seg, uint8_t segIndex); // WLEDMM runs one effect frame, returns frame delay
+
+    polar_map_t* _polarMaps[POLAR_MAP_SLOTS] = {nullptr}; // WLEDMM see getPolarMap()
+
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+    // WLEDMM second render worker (other core), see serviceParallel()
+    TaskHandle_t      _workerTask = nullptr;
+    SemaphoreHandle_t _workerDone = nullptr;
+    unsigned long     _workerNow = 0;
+    uint8_t           _workerJobs[MAX_NUM_SEGMENTS];
+    uint8_t           _workerJobCount = 0;
+
+    bool serviceParallel(unsigned long nowUp);
+    static void renderWorkerTask(void *param);
+#endif
 };
 
 extern const char JSON_mode_names[];
@@ -25,6 +25,7 @@
 #include "wled.h"
 #include "FX.h"
 #include "palettes.h"
+#include <algorithm>  // WLEDMM std::rotate
 
 // setUpMatrix() - constructs ledmap array from matrix of panels with WxH pixels
 // this converts physical (possibly irregular) LED arrangement into well defined
@@ -149,6 +150,8 @@ void WS2812FX::setUpMatrix() {
 
       // delete gap array as we no longer need it
       if (gapTable) {delete[] gapTable; gapTable=nullptr;}   // softhack prevent dangling pointer
+      classifyMapping();              // WLEDMM standard panels don't need the table lookup
+      Segment::invalidatePixelMaps(); // WLEDMM ledmap has changed
 
       #ifdef WLED_DEBUG_MAPS
       DEBUG_PRINTF("Matrix ledmap: \n");
@@ -183,9 +186,9 @@ void IRAM_ATTR_YN WS2812FX::setPixelColorXY(int x, int y, uint32_t col) //WLEDMM
   if (!isMatrix) return; // not a matrix set-up
   uint_fast16_t index = y * Segment::maxWidth + x;
 #else
-  uint16_t index = x;
+  uint16_t index = x; y = 0;
 #endif
-  if (index < customMappingSize) index = customMappingTable[index];
+  if (index < customMappingSize) index = mapPixelXY(x, y, index); // WLEDMM computed for regular layouts
   if (index >= _length) return;
   busses.setPixelColor(index, col);
 }
@@ -195,13 +198,103 @@ uint32_t WS2812FX::getPixelColorXY(uint16_t x, uint16_t y) {
 #ifndef WLED_DISABLE_2D
   uint_fast16_t index = (y * Segment::maxWidth + x); //WLEDMM: use fast types
 #else
-  uint16_t index = x;
+  uint16_t index = x; y = 0;
 #endif
-  if (index < customMappingSize) index = customMappingTable[index];
+  if (index < customMappingSize) index = mapPixelXY(x, y, index); // WLEDMM computed for regular layouts
   if (index >= _length) return 0;
   return busses.getPixelColor(index);
 }
 
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+static portMUX_TYPE polarMapMux = portMUX_INITIALIZER_UNLOCKED; // WLEDMM polar tables are shared by both render workers
+#define POLAR_LOCK()   portENTER_CRITICAL(&polarMapMux)
+#define POLAR_UNLOCK() portEXIT_CRITICAL(&polarMapMux)
+#else
+#define POLAR_LOCK()
+#define POLAR_UNLOCK()
+#endif
+
+// WLEDMM shared polar coordinate table: angle and radius of every pixel in a cols x rows grid around (cx,cy).
+// Tables are cached per geometry + center, so effects don't need atan2f()/hypotf() per pixel; a resized segment simply gets a new table.
+// Tables requested during the current frame are never evicted, so the returned pointer stays valid until the effect function returns.
+// Returns nullptr if no memory (or while another render worker is still building the same table) - effects must have a fallback.
+const polar_map_t* WS2812FX::getPolarMap(uint16_t cols, uint16_t rows, int16_t cx, int16_t cy) {
+  if ((cols == 0) || (rows == 0)) return nullptr;
+  int victim = -1, empty = -1;
+  unsigned long oldest = 0;
+  POLAR_LOCK();
+  for (int i = 0; i < POLAR_MAP_SLOTS; i++) {
+    polar_map_t *m = _polarMaps[i];
+    if (m == nullptr) { if (empty < 0) empty = i; continue; }
+    if ((m->cols == cols) && (m->rows == rows) && (m->cx == cx) && (m->cy == cy)) {
+      if (m->ready) m->lastUsed = now;
+      POLAR_UNLOCK();
+      return m->ready ? m : nullptr;
+    }
+    if (m->ready && (m->lastUsed != now) && (now - m->lastUsed >= oldest)) { victim = i; oldest = now - m->lastUsed; } // least recently used
+  }
+  if (empty >= 0) victim = empty;
+  if (victim < 0) { POLAR_UNLOCK(); return nullptr; } // all tables are in use by this frame
+  polar_map_t *old = _polarMaps[victim];
+  _polarMaps[victim] = nullptr;
+  POLAR_UNLOCK();
+  if (old) free(old);
+
+  polar_map_t *m = (polar_map_t*) malloc(sizeof(polar_map_t) + sizeof(polar_px_t) * cols * rows);
+  if (m == nullptr) return nullptr;
+  m->cols = cols; m->rows = rows; m->cx = cx; m->cy = cy;
+  m->lastUsed = now;
+  m->ready = false;
+  POLAR_LOCK();
+  bool slotFree = (_polarMaps[victim] == nullptr);
+  if (slotFree) _polarMaps[victim] = m; // publish, so the other worker waits instead of building the same table
+  POLAR_UNLOCK();
+  if (!slotFree) { free(m); return nullptr; }
+
+  polar_px_t *px = m->px;
+  for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) {
+    float dx = x - cx, dy = y - cy;
+    px->angle  = uint16_t(int(atan2f(dy, dx) * (65536.0f / TWO_PI)));
+    px->radius = uint16_t(min(hypotf(dx, dy) * 256.0f, 65535.0f));
+    px++;
+  }
+  m->ready = true;
+  return m;
+}
+
+void WS2812FX::purgePolarMaps() {
+  POLAR_LOCK();
+  polar_map_t *maps[POLAR_MAP_SLOTS];
+  for (int i = 0; i < POLAR_MAP_SLOTS; i++) { maps[i] = _polarMaps[i]; _polarMaps[i] = nullptr; }
+  POLAR_UNLOCK();
+  for (int i = 0; i < POLAR_MAP_SLOTS; i++) if (maps[i]) free(maps[i]);
+}
+
+// WLEDMM blur2D() scratch for segments without leds[]: one per render worker, grows on demand, freed by purgeIdleBuffers() when idle
+static uint32_t     *blurScratch[WLED_RENDER_WORKERS]     = {nullptr};
+static size_t        blurScratchLen[WLED_RENDER_WORKERS]  = {0}; // pixels
+static unsigned long blurScratchUsed[WLED_RENDER_WORKERS] = {0};
+
+// WLEDMM called by service() between frames (no effect is running): frees what the effects have stopped using, e.g. after switching away from Octopus
+void WS2812FX::purgeIdleBuffers() {
+  for (unsigned w = 0; w < WLED_RENDER_WORKERS; w++) {
+    if (blurScratch[w] && (now - blurScratchUsed[w] > RENDER_BUFFER_TIMEOUT)) {
+      free(blurScratch[w]);
+      blurScratch[w] = nullptr;
+      blurScratchLen[w] = 0;
+    }
+  }
+
+  polar_map_t *idle[POLAR_MAP_SLOTS] = {nullptr};
+  POLAR_LOCK();
+  for (int i = 0; i < POLAR_MAP_SLOTS; i++) {
+    polar_map_t *m = _polarMaps[i];
+    if (m && m->ready && (now - m->lastUsed > RENDER_BUFFER_TIMEOUT)) { idle[i] = m; _polarMaps[i] = nullptr; }
+  }
+  POLAR_UNLOCK();
+  for (int i = 0; i < POLAR_MAP_SLOTS; i++) if (idle[i]) free(idle[i]);
+}
+
 ///////////////////////////////////////////////////////////
 // Segment:: routines
 ///////////////////////////////////////////////////////////
@@ -282,41 +375,8 @@ void Segment::setPixelColorXY(float x, float y, uint32_t col, bool aa, bool fast
 
   float fX = x * (cols-1);
   float fY = y * (rows-1);
-  if (aa) {
-    uint16_t xL = roundf(fX-0.49f);
-    uint16_t xR = roundf(fX+0.49f);
-    uint16_t yT = roundf(fY-0.49f);
-    uint16_t yB = roundf(fY+0.49f);
-    float    dL = (fX - xL)*(fX - xL);
-    float    dR = (xR - fX)*(xR - fX);
-    float    dT = (fY - yT)*(fY - yT);
-    float    dB = (yB - fY)*(yB - fY);
-    uint32_t cXLYT = getPixelColorXY(xL, yT);
-    uint32_t cXRYT = getPixelColorXY(xR, yT);
-    uint32_t cXLYB = getPixelColorXY(xL, yB);
-    uint32_t cXRYB = getPixelColorXY(xR, yB);
-
-    if (xL!=xR && yT!=yB) {
-      if (!fast) {
-        setPixelColorXY(xL, yT, color_blend(col, cXLYT, uint8_t(sqrtf(dL*dT)*255.0f))); // blend TL pixel
-        setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(sqrtf(dR*dT)*255.0f))); // blend TR pixel
-        setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(sqrtf(dL*dB)*255.0f))); // blend BL pixel
-        setPixelColorXY(xR, yB, color_blend(col, cXRYB, uint8_t(sqrtf(dR*dB)*255.0f))); // blend BR pixel
-      } else {
-        setPixelColorXY(xL, yT, color_blend(col, cXLYT, uint8_t(sqrt16(dL*dT*65025.0f)))); // blend TL pixel     // WLEDMM: use faster sqrt16 for integer; perform multiplication by 255^2 before sqrt
-        setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(sqrt16(dR*dT*65025.0f)))); // blend TR pixel     //         this is possible because sqrt(a) * sqrt(b)  =  sqrt(a * b)
-        setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(sqrt16(dL*dB*65025.0f)))); // blend BL pixel
-        setPixelColorXY(xR, yB, color_blend(col, cXRYB, uint8_t(sqrt16(dR*dB*65025.0f)))); // blend BR pixel
-      }
-    } else if (xR!=xL && yT==yB) {
-      setPixelColorXY(xR, yT, color_blend(col, cXLYT, uint8_t(dL*255.0f))); // blend L pixel
-      setPixelColorXY(xR, yT, color_blend(col, cXRYT, uint8_t(dR*255.0f))); // blend R pixel
-    } else if (xR==xL && yT!=yB) {
-      setPixelColorXY(xR, yT, color_blend(col, cXLYT, uint8_t(dT*255.0f))); // blend T pixel
-      setPixelColorXY(xL, yB, color_blend(col, cXLYB, uint8_t(dB*255.0f))); // blend B pixel
-    } else {
-      setPixelColorXY(xL, yT, col); // exact match (x & y land on a pixel)
-    }
+  if (aa) { // WLEDMM integer Wu kernel, see setPixelColorXYQ8()
+    setPixelColorXYQ8(int32_t(fX * 256.0f + 0.5f), int32_t(fY * 256.0f + 0.5f), col);
   } else {
     setPixelColorXY(uint16_t(roundf(fX)), uint16_t(roundf(fY)), col);
   }
@@ -358,6 +418,31 @@ void Segment::fadePixelColorXY(uint16_t x, uint16_t y, uint8_t fade) {
   setPixelColorXY(x, y, pix);
 }
 
+// WLEDMM blur engine: one blur pass over n pixels p[0], p[stride], p[2*stride] ... in place.
+// Same math as the per-pixel blurRow()/blurCol() code, but without mapping, brightness and bus lookups per access.
+static inline uint32_t blurGet(const CRGB &c) { return RGBW32(c.r, c.g, c.b, 0); }
+static inline uint32_t blurGet(uint32_t c)    { return c; }
+static inline void     blurPut(CRGB &d, uint32_t c)     { d = CRGB(c); }
+static inline void     blurPut(uint32_t &d, uint32_t c) { d = c; }
+
+template<typename T> static void blurLine(T *p, unsigned n, unsigned stride, uint8_t keep, uint8_t seep, bool smear) {
+  uint32_t carryover = BLACK;
+  uint32_t lastnew = 0;
+  uint32_t curnew = 0;
+  for (unsigned i = 0; i < n; i++) {
+    uint32_t cur = blurGet(p[i * stride]);
+    uint32_t part = color_fade(cur, seep);
+    curnew = color_fade(cur, keep);
+    if (i > 0) {
+      if (carryover) curnew = color_add(curnew, carryover, !smear); // WLEDMM don't use "fast" when smear==true (better handling of bright colors)
+      blurPut(p[(i - 1) * stride], color_add(lastnew, part, !smear));
+    }
+    lastnew = curnew;
+    carryover = part;
+  }
+  if (n > 0) blurPut(p[(n - 1) * stride], curnew); // set last pixel
+}
+
 // blurRow: perform a blur on a row of a rectangular matrix
 void Segment::blurRow(uint32_t row, fract8 blur_amount, bool smear){
   if (!isActive()) return; // not active
@@ -368,6 +453,12 @@ void Segment::blurRow(uint32_t row, fract8 blur_amount, bool smear){
   // blur one row
   uint8_t keep = smear ? 255 : 255 - blur_amount;
   uint8_t seep = blur_amount >> 1;
+  if (ledsrgb && Segment::maxHeight > 1) { // WLEDMM blur inside leds[], then write the row back once
+    CRGB *line = &ledsrgb[XY(0, row)];
+    blurLine(line, cols, 1, keep, seep, smear);
+    for (unsigned x = 0; x < cols; x++) setPixelColorXY(int(x), int(row), blurGet(line[x]));
+    return;
+  }
   uint32_t carryover = BLACK;
   uint32_t lastnew;
   uint32_t last;
@@ -402,6 +493,12 @@ void Segment::blurCol(uint32_t col, fract8 blur_amount, bool smear) {
   // blur one column
   uint8_t keep = smear ? 255 : 255 - blur_amount;
   uint8_t seep = blur_amount >> 1;
+  if (ledsrgb && Segment::maxHeight > 1) { // WLEDMM blur inside leds[], then write the column back once
+    CRGB *line = &ledsrgb[XY(col, 0)];
+    blurLine(line, rows, cols, keep, seep, smear);
+    for (unsigned y = 0; y < rows; y++) setPixelColorXY(int(col), int(y), blurGet(line[y * cols]));
+    return;
+  }
   uint32_t carryover = BLACK;
   uint32_t lastnew;
   uint32_t last;
@@ -426,6 +523,45 @@ void Segment::blurCol(uint32_t col, fract8 blur_amount, bool smear) {
   setPixelColorXY(int(col), int(rows - 1), curnew);
 }
 
+// WLEDMM separable 2D blur: horizontal pass over all rows, vertical pass over all columns, then a single write-back.
+// Works on leds[] if the segment has one, otherwise on a scratch copy of the segment.
+void Segment::blur2D(fract8 blur_amount, bool smear) {
+  if (!isActive()) return; // not active
+  const uint_fast16_t cols = virtualWidth();
+  const uint_fast16_t rows = virtualHeight();
+  if (cols == 0 || rows == 0) return;
+  uint8_t keep = smear ? 255 : 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+
+  if (ledsrgb) {
+    for (unsigned y = 0; y < rows; y++) blurLine(&ledsrgb[XY(0, y)], cols, 1, keep, seep, smear);
+    for (unsigned x = 0; x < cols; x++) blurLine(&ledsrgb[XY(x, 0)], rows, cols, keep, seep, smear);
+    for (unsigned y = 0; y < rows; y++) {
+      const CRGB *line = &ledsrgb[XY(0, y)];
+      for (unsigned x = 0; x < cols; x++) setPixelColorXY(int(x), int(y), blurGet(line[x]));
+    }
+    return;
+  }
+
+  const size_t len = cols * rows;
+  uint32_t *&buf = blurScratch[FX_WORKER_ID];
+  if (blurScratchLen[FX_WORKER_ID] < len) { // WLEDMM grow only - no malloc/free per frame
+    free(buf);
+    buf = (uint32_t*) malloc(sizeof(uint32_t) * len);
+    blurScratchLen[FX_WORKER_ID] = buf ? len : 0;
+  }
+  blurScratchUsed[FX_WORKER_ID] = strip.now;
+  if (buf == nullptr) { // no memory - fall back to blurring on the busses
+    for (unsigned y = 0; y < rows; y++) blurRow(y, blur_amount, smear);
+    for (unsigned x = 0; x < cols; x++) blurCol(x, blur_amount, smear);
+    return;
+  }
+  for (unsigned y = 0; y < rows; y++) for (unsigned x = 0; x < cols; x++) buf[y * cols + x] = getPixelColorXY(int(x), int(y));
+  for (unsigned y = 0; y < rows; y++) blurLine(&buf[y * cols], cols, 1, keep, seep, smear);
+  for (unsigned x = 0; x < cols; x++) blurLine(&buf[x], rows, cols, keep, seep, smear);
+  for (unsigned y = 0; y < rows; y++) for (unsigned x = 0; x < cols; x++) setPixelColorXY(int(x), int(y), buf[y * cols + x]);
+}
+
 // 1D Box blur (with added weight - blur_amount: [0=no blur, 255=max blur])
 void Segment::box_blur(uint16_t i, bool vertical, fract8 blur_amount) {  //WLEDMM: use fast types
   const uint_fast16_t cols = virtualWidth();
@@ -433,25 +569,20 @@ void Segment::box_blur(uint16_t i, bool vertical, fract8 blur_amount) {  //WLEDM
   const uint_fast16_t dim1 = vertical ? rows : cols;
   const uint_fast16_t dim2 = vertical ? cols : rows;
   if (i >= dim2) return;
-  const float seep = blur_amount/255.f;
-  const float keep = 3.f - 2.f*seep;
-  // 1D box blur
+  // WLEDMM integer kernel: (curr*(3-2*seep) + (prev+next)*seep) / 3 with seep = blur_amount/255, scaled by 765 = 3*255
+  const uint32_t seep = blur_amount;
+  const uint32_t keep = 765 - 2*blur_amount;
+  // 1D box blur - WLEDMM read each pixel once
   CRGB tmp[dim1];
+  for (uint_fast16_t j = 0; j < dim1; j++) tmp[j] = vertical ? getPixelColorXY(int(i), int(j)) : getPixelColorXY(int(j), int(i));
+  CRGB prev = CRGB::Black;
   for (uint_fast16_t j = 0; j < dim1; j++) {
-    uint_fast16_t x = vertical ? i : j;
-    uint_fast16_t y = vertical ? j : i;
-    int_fast16_t xp = vertical ? x : x-1;  // "signed" to prevent underflow
-    int_fast16_t yp = vertical ? y-1 : y;  // "signed" to prevent underflow
-    uint_fast16_t xn = vertical ? x : x+1;
-    uint_fast16_t yn = vertical ? y+1 : y;
-    CRGB curr = getPixelColorXY(x,y);
-    CRGB prev = (xp<0 || yp<0) ? CRGB::Black : getPixelColorXY(xp,yp);
-    CRGB next = ((vertical && yn>=dim1) || (!vertical && xn>=dim1)) ? CRGB::Black : getPixelColorXY(xn,yn);
-    uint16_t r, g, b;
-    r = (curr.r*keep + (prev.r + next.r)*seep) / 3;
-    g = (curr.g*keep + (prev.g + next.g)*seep) / 3;
-    b = (curr.b*keep + (prev.b + next.b)*seep) / 3;
-    tmp[j] = CRGB(r,g,b);
+    CRGB curr = tmp[j];
+    CRGB next = (j + 1 < dim1) ? tmp[j + 1] : CRGB::Black;
+    tmp[j] = CRGB((curr.r*keep + (prev.r + next.r)*seep) / 765,
+                  (curr.g*keep + (prev.g + next.g)*seep) / 765,
+                  (curr.b*keep + (prev.b + next.b)*seep) / 765);
+    prev = curr; // original value
   }
   for (uint_fast16_t j = 0; j < dim1; j++) {
     uint_fast16_t x = vertical ? i : j;
@@ -479,11 +610,54 @@ void Segment::blur1d(fract8 blur_amount) {   //WLEDMM: use fast types
   for (uint_fast16_t y = 0; y < rows; y++) blurRow(y, blur_amount);
 }
 
+// WLEDMM in-buffer shifts for moveX(), moveY() and move(). leds[] holds the virtual matrix row by row,
+// so reverse and transpose are applied when the buffer is written back with setPixelColorXY().
+static void shiftLedsX(CRGB *leds, unsigned cols, unsigned rows, int delta, bool wrap) {
+  const unsigned d = abs(delta);
+  CRGB wrapped[d];
+  for (unsigned y = 0; y < rows; y++) {
+    CRGB *line = &leds[y * cols];
+    if (delta > 0) { // pixels move left
+      if (wrap) memcpy(wrapped, line, d * sizeof(CRGB));
+      memmove(line, line + d, (cols - d) * sizeof(CRGB));
+      if (wrap) memcpy(line + cols - d, wrapped, d * sizeof(CRGB));
+    } else {         // pixels move right
+      if (wrap) memcpy(wrapped, line + cols - d, d * sizeof(CRGB));
+      memmove(line + d, line, (cols - d) * sizeof(CRGB));
+      if (wrap) memcpy(line, wrapped, d * sizeof(CRGB));
+    }
+  }
+}
+
+static void shiftLedsY(CRGB *leds, unsigned cols, unsigned rows, int delta, bool wrap) {
+  const unsigned d = abs(delta);
+  CRGB *last = &leds[rows * cols];
+  if (wrap) { // d complete rows would need a big temp buffer - rotate in place instead
+    if (delta > 0) std::rotate(leds, leds + d * cols, last);          // pixels move up
+    else           std::rotate(leds, leds + (rows - d) * cols, last); // pixels move down
+  } else {
+    if (delta > 0) memmove(leds, leds + d * cols, (rows - d) * cols * sizeof(CRGB));
+    else           memmove(leds + d * cols, leds, (rows - d) * cols * sizeof(CRGB));
+  }
+}
+
+static void writeBackLeds(Segment &seg, unsigned cols, unsigned rows) {
+  for (unsigned y = 0; y < rows; y++) {
+    const CRGB *line = &seg.ledsrgb[y * cols];
+    for (unsigned x = 0; x < cols; x++) seg.setPixelColorXY(int(x), int(y), RGBW32(line[x].r, line[x].g, line[x].b, 0));
+  }
+}
+
 void Segment::moveX(int8_t delta, bool wrap) {
   if (!isActive()) return; // not active
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (!delta || abs(delta) >= cols) return;
+  if (ledsrgb && Segment::maxHeight > 1) { // WLEDMM one memmove per row inside leds[], then write back once
+    shiftLedsX(ledsrgb, cols, rows, delta, wrap);
+    writeBackLeds(*this, cols, rows);
+    return;
+  }
   uint32_t newPxCol[cols];
   for (int y = 0; y < rows; y++) {
     if (delta > 0) {
@@ -502,6 +676,11 @@ void Segment::moveY(int8_t delta, bool wrap) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (!delta || abs(delta) >= rows) return;
+  if (ledsrgb && Segment::maxHeight > 1) { // WLEDMM rows are contiguous in leds[] - move them as one block, then write back once
+    shiftLedsY(ledsrgb, cols, rows, delta, wrap);
+    writeBackLeds(*this, cols, rows);
+    return;
+  }
   uint32_t newPxCol[rows];
   for (int x = 0; x < cols; x++) {
     if (delta > 0) {
@@ -521,6 +700,20 @@ void Segment::moveY(int8_t delta, bool wrap) {
 // @param wrap around
 void Segment::move(uint8_t dir, uint8_t delta, bool wrap) {
   if (delta==0) return;
+  if (ledsrgb && Segment::maxHeight > 1 && isActive()) { // WLEDMM diagonal moves: shift both axes inside leds[], write back only once
+    const int cols = virtualWidth();
+    const int rows = virtualHeight();
+    const int8_t dxTable[8] = { int8_t(delta), int8_t(delta), 0, int8_t(-delta), int8_t(-delta), int8_t(-delta), 0, int8_t(delta) };
+    const int8_t dyTable[8] = { 0, int8_t(delta), int8_t(delta), int8_t(delta), 0, int8_t(-delta), int8_t(-delta), int8_t(-delta) };
+    if (dir > 7) return;
+    const int dx = dxTable[dir];
+    const int dy = dyTable[dir];
+    bool changed = false;
+    if (dx && abs(dx) < cols) { shiftLedsX(ledsrgb, cols, rows, dx, wrap); changed = true; }
+    if (dy && abs(dy) < rows) { shiftLedsY(ledsrgb, cols, rows, dy, wrap); changed = true; }
+    if (changed) writeBackLeds(*this, cols, rows);
+    return;
+  }
   switch (dir) {
     case 0: moveX( delta, wrap);                      break;
     case 1: moveX( delta, wrap); moveY( delta, wrap); break;
@@ -669,6 +862,69 @@ bool Segment::jsonToPixels(char * name, uint8_t fileNr) {
 
 // draws a raster font character on canvas
 // only supports: 4x6=24, 5x8=40, 5x12=60, 6x8=48 and 7x9=63 fonts ATM
+// WLEDMM pre-rasterized glyphs: for each character row, the runs of lit pixels in drawing order (left to right).
+// Built once per font (max 5 fonts, ~1-2KB each) and kept, so drawCharacter() does not test font bits for every pixel.
+#define GLYPH_CHARS 95 // ASCII 32-126
+typedef struct GlyphFont {
+  uint8_t  w;
+  uint8_t  h;
+  uint16_t *rowStart;   // GLYPH_CHARS*h+1 offsets into runs[]
+  uint8_t  *runs;       // start column (bits 0-3) | run length (bits 4-7)
+} glyph_font_t;
+
+static const uint8_t* getFontTable(int font) {
+  switch (font) {
+    case 24: return console_font_4x6;
+    case 40: return console_font_5x8;
+    case 48: return console_font_6x8;
+    case 63: return console_font_7x9;
+    case 60: return console_font_5x12;
+    default: return nullptr;
+  }
+}
+
+static const glyph_font_t* getGlyphFont(uint8_t w, uint8_t h) {
+  static glyph_font_t* fonts[5] = {nullptr};
+  const int font = w*h;
+  const int slot = (font == 24) ? 0 : (font == 40) ? 1 : (font == 48) ? 2 : (font == 63) ? 3 : (font == 60) ? 4 : -1;
+  const uint8_t *table = getFontTable(font);
+  if ((slot < 0) || (table == nullptr) || (w > 8)) return nullptr;
+  const glyph_font_t *published = __atomic_load_n(&fonts[slot], __ATOMIC_ACQUIRE); // sees the font contents if it sees the pointer
+  if (published) return published;
+
+  // count runs, then fill
+  const unsigned numRows = GLYPH_CHARS * h;
+  unsigned numRuns = 0;
+  for (unsigned r = 0; r < numRows; r++) {
+    uint8_t bits = pgm_read_byte_near(&table[r]);
+    for (unsigned c = 0; c < w; c++) if ((bits & (0x80 >> c)) && ((c == 0) || !(bits & (0x100 >> c)))) numRuns++; // run starts here
+  }
+  glyph_font_t *gf = (glyph_font_t*) malloc(sizeof(glyph_font_t) + (numRows + 1) * sizeof(uint16_t) + numRuns);
+  if (gf == nullptr) return nullptr; // no problem - drawCharacter() reads the font directly
+  gf->w = w;
+  gf->h = h;
+  gf->rowStart = (uint16_t*)(gf + 1);
+  gf->runs = (uint8_t*)(gf->rowStart + numRows + 1);
+  unsigned n = 0;
+  for (unsigned r = 0; r < numRows; r++) {
+    gf->rowStart[r] = n;
+    uint8_t bits = pgm_read_byte_near(&table[r]);
+    for (unsigned c = 0; c < w; ) {
+      if (!(bits & (0x80 >> c))) { c++; continue; }
+      unsigned len = 1;
+      while ((c + len < w) && (bits & (0x80 >> (c + len)))) len++;
+      gf->runs[n++] = c | (len << 4);
+      c += len;
+    }
+  }
+  gf->rowStart[numRows] = n;
+  // publish; if the other render worker was faster, use its font and drop ours
+  glyph_font_t *expected = nullptr;
+  if (__atomic_compare_exchange_n(&fonts[slot], &expected, gf, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) return gf;
+  free(gf);
+  return expected;
+}
+
 void Segment::drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w, uint8_t h, uint32_t color, uint32_t col2) {
   if (!isActive()) return; // not active
   if (chr < 32 || chr > 126) return; // only ASCII 32-126 supported
@@ -676,24 +932,37 @@ void Segment::drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w,
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   const int font = w*h;
+  if ((x + w <= 0) || (x >= cols) || (y + h <= 0) || (y >= rows)) return; // WLEDMM character is off-screen
 
   CRGB col = CRGB(color);
+  const bool gradient = col2 && (col2 != color); // WLEDMM single color: no need to pick a color for each row
   CRGBPalette16 grad = CRGBPalette16(col, col2 ? CRGB(col2) : col);
 
+  const glyph_font_t *gf = getGlyphFont(w, h);
+  if (gf) { // WLEDMM fast path - blit pre-rasterized runs
+    for (int i = max(0, -y); i<h; i++) { // character height
+      int16_t y0 = y + i;
+      if (y0 >= rows) break; // drawing off-screen
+      if (gradient) col = ColorFromPalette(grad, (i+1)*255/h, 255, NOBLEND);
+      const uint32_t c = RGBW32(col.r, col.g, col.b, 0);
+      const unsigned row = chr * h + i;
+      for (unsigned r = gf->rowStart[row]; r < gf->rowStart[row+1]; r++) {
+        const int x0 = x + (gf->runs[r] & 0x0F);
+        const int x1 = min(x0 + (gf->runs[r] >> 4), int(cols));
+        for (int xx = max(x0, 0); xx < x1; xx++) setPixelColorXY(xx, int(y0), c);
+      }
+    }
+    return;
+  }
+
   //if (w<5 || w>6 || h!=8) return;
+  const uint8_t *table = getFontTable(font);
+  if (table == nullptr) return;
   for (int i = 0; i<h; i++) { // character height
     int16_t y0 = y + i;
     if (y0 < 0) continue; // drawing off-screen
     if (y0 >= rows) break; // drawing off-screen
-    uint8_t bits = 0;
-    switch (font) {
-      case 24: bits = pgm_read_byte_near(&console_font_4x6[(chr * h) + i]); break;  // 5x8 font
-      case 40: bits = pgm_read_byte_near(&console_font_5x8[(chr * h) + i]); break;  // 5x8 font
-      case 48: bits = pgm_read_byte_near(&console_font_6x8[(chr * h) + i]); break;  // 6x8 font
-      case 63: bits = pgm_read_byte_near(&console_font_7x9[(chr * h) + i]); break;  // 7x9 font
-      case 60: bits = pgm_read_byte_near(&console_font_5x12[(chr * h) + i]); break; // 5x12 font
-      default: return;
-    }
+    uint8_t bits = pgm_read_byte_near(&table[(chr * h) + i]);
     col = ColorFromPalette(grad, (i+1)*255/h, 255, NOBLEND);
     for (int j = 0; j<w; j++) { // character width
       int16_t x0 = x + (w-1) - j;
@@ -705,20 +974,102 @@ void Segment::drawCharacter(unsigned char chr, int16_t x, int16_t y, uint8_t w,
 }
 
 #define WU_WEIGHT(a,b) ((uint8_t) (((a)*(b)+(a)+(b))>>8))
-void Segment::wu_pixel(uint32_t x, uint32_t y, CRGB c) {      //awesome wu_pixel procedure by reddit u/sutaburosu
+// WLEDMM Q8.8 sub-pixel drawing: coordinates are in 1/256 pixel, pixel (x,y) sits at (x<<8, y<<8).
+// Integer-only, so it does not need an FPU (ESP32-C3/S2). Pixels are read from and written to the segment buffer when available.
+
+// put color c with coverage a (0..255) into pixel x,y: blend by coverage, or add scaled light
+static void wuPlot(Segment &seg, int x, int y, uint32_t c, uint8_t a, bool add) {
+  if ((a == 0) || (x < 0) || (y < 0) || (x >= seg.virtualWidth()) || (y >= seg.virtualHeight())) return;
+  if (seg.ledsrgb) { // WLEDMM mix inside leds[] - no getPixelColorXY() round trip, the result goes to the strip once
+    CRGB &led = seg.ledsrgb[seg.XY(x, y)];
+    if (add) {
+      led.r = qadd8(led.r, R(c) * a >> 8);
+      led.g = qadd8(led.g, G(c) * a >> 8);
+      led.b = qadd8(led.b, B(c) * a >> 8);
+    } else if (a < 255) {
+      led = CRGB(color_blend(RGBW32(led.r, led.g, led.b, 0), c, a));
+    } else {
+      seg.setPixelColorXY(x, y, c); // full coverage: plain set, keeps the white channel
+      return;
+    }
+    seg.setPixelColorXY(x, y, RGBW32(led.r, led.g, led.b, 0));
+    return;
+  }
+  if (add) { // awesome wu_pixel procedure by reddit u/sutaburosu
+    CRGB led = seg.getPixelColorXY(x, y);
+    led.r = qadd8(led.r, R(c) * a >> 8);
+    led.g = qadd8(led.g, G(c) * a >> 8);
+    led.b = qadd8(led.b, B(c) * a >> 8);
+    seg.setPixelColorXY(x, y, RGBW32(led.r, led.g, led.b, 0));
+  } else {
+    seg.setPixelColorXY(x, y, (a == 255) ? c : color_blend(seg.getPixelColorXY(x, y), c, a));
+  }
+}
+
+// point, spread over the 4 surrounding pixels
+void Segment::setPixelColorXYQ8(int32_t x, int32_t y, uint32_t c, bool add) {
   if (!isActive()) return; // not active
   // extract the fractional parts and derive their inverses
-  uint8_t xx = x & 0xff, yy = y & 0xff, ix = 255 - xx, iy = 255 - yy;
-  // calculate the intensities for each affected pixel
-  uint8_t wu[4] = {WU_WEIGHT(ix, iy), WU_WEIGHT(xx, iy),
-                   WU_WEIGHT(ix, yy), WU_WEIGHT(xx, yy)};
-  // multiply the intensities by the colour, and saturating-add them to the pixels
-  for (int i = 0; i < 4; i++) {
-    CRGB led = getPixelColorXY((x >> 8) + (i & 1), (y >> 8) + ((i >> 1) & 1));
-    led.r = qadd8(led.r, c.r * wu[i] >> 8);
-    led.g = qadd8(led.g, c.g * wu[i] >> 8);
-    led.b = qadd8(led.b, c.b * wu[i] >> 8);
-    setPixelColorXY(int((x >> 8) + (i & 1)), int((y >> 8) + ((i >> 1) & 1)), led);
+  const int xi = x >> 8, yi = y >> 8;
+  const uint8_t xx = x & 0xff, yy = y & 0xff, ix = 255 - xx, iy = 255 - yy;
+  wuPlot(*this, xi,   yi,   c, WU_WEIGHT(ix, iy), add);
+  wuPlot(*this, xi+1, yi,   c, WU_WEIGHT(xx, iy), add);
+  wuPlot(*this, xi,   yi+1, c, WU_WEIGHT(ix, yy), add);
+  wuPlot(*this, xi+1, yi+1, c, WU_WEIGHT(xx, yy), add);
+}
+
+// anti-aliased line (Xiaolin Wu): one step per pixel along the major axis, two pixels shaded across it
+void Segment::drawLineQ8(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t c, bool add) {
+  if (!isActive()) return; // not active
+  const bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+  if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+  const int32_t dx = x1 - x0;
+  const int32_t gradient = (dx > 0) ? int32_t((int64_t(y1 - y0) << 16) / dx) : 0; // minor axis change per pixel, Q16
+  const int xs = (x0 + 128) >> 8;
+  const int xe = (x1 + 128) >> 8;
+  int32_t yAcc = (y0 << 8) + ((gradient * ((xs << 8) - x0)) >> 8);  // Q16.16 position on the minor axis
+  for (int x = xs; x <= xe; x++, yAcc += gradient) {
+    const int yi = yAcc >> 16;
+    const uint8_t f = (yAcc >> 8) & 0xff;
+    if (steep) { wuPlot(*this, yi, x, c, 255 - f, add); wuPlot(*this, yi + 1, x, c, f, add); }
+    else       { wuPlot(*this, x, yi, c, 255 - f, add); wuPlot(*this, x, yi + 1, c, f, add); }
+  }
+}
+
+static uint32_t isqrt32(uint32_t n) {
+  uint32_t root = 0, bit = 1UL << 30;
+  while (bit > n) bit >>= 2;
+  while (bit) {
+    if (n >= root + bit) { n -= root + bit; root = (root >> 1) + bit; }
+    else root >>= 1;
+    bit >>= 2;
+  }
+  return root;
+}
+
+// anti-aliased circle outline (Wu), the center snaps to the nearest pixel; radius < 256 pixels
+void Segment::drawCircleQ8(int32_t cx, int32_t cy, int32_t radius, uint32_t c, bool add) {
+  if (!isActive()) return; // not active
+  if (radius <= 0) { setPixelColorXYQ8(cx, cy, c, add); return; }
+  if (radius > 0xFFFF) radius = 0xFFFF;
+  const int x0 = (cx + 128) >> 8;
+  const int y0 = (cy + 128) >> 8;
+  const uint32_t r2 = uint32_t(radius) * uint32_t(radius);  // Q16.16
+  const int last = (radius * 181) >> 16;                    // r / sqrt(2) in pixels - one octant
+  for (int d = 0; d <= last; d++) {
+    const uint32_t yq = isqrt32(r2 - uint32_t(d << 8) * uint32_t(d << 8)); // Q8.8
+    const int yi = yq >> 8;
+    const uint8_t f = yq & 0xff;
+    for (int k = 0; k < 2; k++) { // inner pixel, then outer pixel
+      const int y = yi + k;
+      const uint8_t a = k ? f : 255 - f;
+      wuPlot(*this, x0 + d, y0 + y, c, a, add); wuPlot(*this, x0 + d, y0 - y, c, a, add);
+      wuPlot(*this, x0 + y, y0 + d, c, a, add); wuPlot(*this, x0 - y, y0 + d, c, a, add);
+      if (d == 0) continue; // avoid painting the axis pixels twice
+      wuPlot(*this, x0 - d, y0 + y, c, a, add); wuPlot(*this, x0 - d, y0 - y, c, a, add);
+      wuPlot(*this, x0 + y, y0 - d, c, a, add); wuPlot(*this, x0 - y, y0 - d, c, a, add);
+    }
   }
 }
 #undef WU_WEIGHT
@@ -28,6 +28,12 @@
 #include "palettes.h"
 #ifdef ARDUINO_ARCH_ESP32
 #include <esp_timer.h>     // WLEDMM to get esp_timer_get_time() 
+#if ESP_IDF_VERSION_MAJOR >= 4
+#include <esp_rom_crc.h>   // WLEDMM esp_rom_crc32_le()
+#else
+#include <rom/crc.h>       // WLEDMM crc32_le()
+#define esp_rom_crc32_le crc32_le
+#endif
 #endif
 
 /*
@@ -94,8 +100,25 @@ size_t Segment::_usedSegmentData = 0U; // amount of RAM all segments use for the
 CRGB    *Segment::_globalLeds = nullptr;
 uint16_t Segment::maxWidth = DEFAULT_LED_COUNT;
 uint16_t Segment::maxHeight = 1;
+uint32_t Segment::_pixelMapGeneration = 0;
+uint16_t Segment::_paletteGeneration = 0;
 
-CRGBPalette16 Segment::_currentPalette    = CRGBPalette16(CRGB::Black);
+CRGBPalette16 Segment::_currentPalette[WLED_RENDER_WORKERS];
+
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+__thread uint8_t fxWorkerId = 0;  // WLEDMM set to 1 by the second render worker task
+static portMUX_TYPE segDataMux = portMUX_INITIALIZER_UNLOCKED; // WLEDMM _usedSegmentData is shared by both render workers
+#endif
+
+void Segment::addUsedSegmentData(int len) {
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+  portENTER_CRITICAL(&segDataMux);
+  _usedSegmentData += len;
+  portEXIT_CRITICAL(&segDataMux);
+#else
+  _usedSegmentData += len;
+#endif
+}
 
 // copy constructor - creates a new segment by copy from orig, but does not copy buffers. Does not modify orig!
 Segment::Segment(const Segment &orig) {
@@ -106,6 +129,9 @@ Segment::Segment(const Segment &orig) {
   data = nullptr;
   _dataLen = 0;
   _t = nullptr;
+  _pixelMap = nullptr; // WLEDMM will be rebuilt on demand
+  _palCache = nullptr; // WLEDMM will be rebuilt on demand
+  _xyList = nullptr;   // WLEDMM will be rebuilt on demand
   if (ledsrgb && !Segment::_globalLeds) {ledsrgb = nullptr; ledsrgbSize = 0;}  // WLEDMM
   if (orig.name) { name = new char[strlen(orig.name)+1]; if (name) strcpy(name, orig.name); }
   if (orig.data) { if (allocateData(orig._dataLen)) memcpy(data, orig.data, orig._dataLen); }
@@ -152,6 +178,9 @@ Segment::Segment(Segment &&orig) noexcept {
   orig.ledsrgb = nullptr; //WLEDMM
   orig.ledsrgbSize = 0;   // WLEDMM
   orig.jMap = nullptr;    //WLEDMM jMap
+  orig._pixelMap = nullptr; // WLEDMM
+  orig._palCache = nullptr; // WLEDMM
+  orig._xyList = nullptr;   // WLEDMM
 }
 
 // copy assignment --> overwrite segment with orig - deletes old buffers in "this", but does not change orig!
@@ -166,6 +195,9 @@ Segment& Segment::operator= (const Segment &orig) {
     size_t oldLedsSize = ledsrgbSize;
     if (ledsrgb && !Segment::_globalLeds) free(ledsrgb);
     deallocateData();
+    deletePixelMap(); // WLEDMM
+    deletePaletteCache(); // WLEDMM
+    deleteXYList(); // WLEDMM
     // copy source
     memcpy((void*)this, (void*)&orig, sizeof(Segment));
     transitional = false;
@@ -174,6 +206,9 @@ Segment& Segment::operator= (const Segment &orig) {
     data = nullptr;
     _dataLen = 0;
     _t = nullptr;
+    _pixelMap = nullptr; // WLEDMM will be rebuilt on demand
+    _palCache = nullptr; // WLEDMM will be rebuilt on demand
+    _xyList = nullptr;   // WLEDMM will be rebuilt on demand
     //if (!Segment::_globalLeds) {ledsrgb = oldLeds; ledsrgbSize = oldLedsSize;}; // WLEDMM reuse leds instead of ledsrgb = nullptr;
     if (!Segment::_globalLeds) {ledsrgb = nullptr; ledsrgbSize = 0;};             // WLEDMM copy has no buffers (yet)
     // copy source data
@@ -195,6 +230,9 @@ Segment& Segment::operator= (Segment &&orig) noexcept {
     if (name) { delete[] name; name = nullptr; } // free old name
     deallocateData(); // free old runtime data
     if (_t) { delete _t; _t = nullptr; }
+    deletePixelMap(); // WLEDMM
+    deletePaletteCache(); // WLEDMM
+    deleteXYList(); // WLEDMM
     if (ledsrgb && !Segment::_globalLeds) free(ledsrgb); //WLEDMM: not needed anymore as we will use leds from copy. no need to nullify ledsrgb as it gets new value in memcpy
     memcpy((void*)this, (void*)&orig, sizeof(Segment));
     orig.name = nullptr;
@@ -204,6 +242,9 @@ Segment& Segment::operator= (Segment &&orig) noexcept {
     orig.ledsrgb = nullptr;  //WLEDMM: do not free as moved to here
     orig.ledsrgbSize = 0;    //WLEDMM
     orig.jMap = nullptr; //WLEDMM jMap
+    orig._pixelMap = nullptr; // WLEDMM
+    orig._palCache = nullptr; // WLEDMM
+    orig._xyList = nullptr;   // WLEDMM
   }
   return *this;
 }
@@ -291,10 +332,39 @@ void Segment::setUpLeds() {
   }
 }
 
-CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+static portMUX_TYPE randomPaletteMux = portMUX_INITIALIZER_UNLOCKED; // WLEDMM the random palettes are shared by both render workers
+#endif
+
+// WLEDMM the random palettes are shared by all segments: replace them when due and copy them out under the lock, so a
+// segment on the other render worker never blends from a half-written palette. Returns ms since the last change.
+static uint32_t getRandomPalettes(CRGBPalette16 &prev, CRGBPalette16 &next) {
   static unsigned long _lastPaletteChange = millis() - 990000; // perhaps it should be per segment //WLEDMM changed init value to avoid pure orange after startup
   static CRGBPalette16 randomPalette = CRGBPalette16(DEFAULT_COLOR);
   static CRGBPalette16 prevRandomPalette = CRGBPalette16(CRGB(BLACK));
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+  portENTER_CRITICAL(&randomPaletteMux);
+#endif
+  uint32_t timeSinceLastChange = millis() - _lastPaletteChange;
+  if (timeSinceLastChange > randomPaletteChangeTime * 1000U) {
+    prevRandomPalette = randomPalette;
+    randomPalette = CRGBPalette16(
+                    CHSV(random8(), random8(160, 255), random8(128, 255)),
+                    CHSV(random8(), random8(160, 255), random8(128, 255)),
+                    CHSV(random8(), random8(160, 255), random8(128, 255)),
+                    CHSV(random8(), random8(160, 255), random8(128, 255)));
+    _lastPaletteChange = millis();
+    timeSinceLastChange = 0;
+  }
+  prev = prevRandomPalette;
+  next = randomPalette;
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+  portEXIT_CRITICAL(&randomPaletteMux);
+#endif
+  return timeSinceLastChange;
+}
+
+CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
   byte tcp[76] = { 255 };   //WLEDMM: prevent out-of-range access in loadDynamicGradientPalette()
   if (pal < 245 && pal > GRADIENT_PALETTE_COUNT+13) pal = 0;
   if (pal > 245 && (strip.customPalettes.size() == 0 || 255U-pal > strip.customPalettes.size()-1)) pal = 0; // TODO remove strip dependency by moving customPalettes out of strip
@@ -316,17 +386,8 @@ CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
     case 0: //default palette. Exceptions for specific effects above
       targetPalette = PartyColors_p; break;
     case 1: {//Random smooth: periodically replace palette with a random one. Transition palette change in 500ms
-      uint32_t timeSinceLastChange = millis() - _lastPaletteChange;
-      if (timeSinceLastChange > randomPaletteChangeTime * 1000U) {
-        prevRandomPalette = randomPalette;
-        randomPalette = CRGBPalette16(
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)));
-        _lastPaletteChange = millis();
-        timeSinceLastChange = 0;
-      }
+      CRGBPalette16 prevRandomPalette, randomPalette;
+      uint32_t timeSinceLastChange = getRandomPalettes(prevRandomPalette, randomPalette);
 
       //WLEDMM: smooth transitions of palettes instead of every 5 sec with short transition
       for (int i=0; i< 16; i++) {
@@ -336,17 +397,8 @@ CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
       }
       break;}
     case 74: {//periodically replace palette with a random one. Transition palette change in 500ms
-      uint32_t timeSinceLastChange = millis() - _lastPaletteChange;
-      if (timeSinceLastChange > randomPaletteChangeTime * 1000U) {
-        prevRandomPalette = randomPalette;
-        randomPalette = CRGBPalette16(
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)),
-                        CHSV(random8(), random8(160, 255), random8(128, 255)));
-        _lastPaletteChange = millis();
-        timeSinceLastChange = 0;
-      }
+      CRGBPalette16 prevRandomPalette, randomPalette;
+      uint32_t timeSinceLastChange = getRandomPalettes(prevRandomPalette, randomPalette);
       if (timeSinceLastChange <= 250) {
         targetPalette = prevRandomPalette;
         // there needs to be 255 palette blends (48) for full blend but that is too resource intensive
@@ -461,16 +513,74 @@ uint32_t Segment::currentColor(uint8_t slot, uint32_t colorNew) {
 }
 
 void Segment::setCurrentPalette() {
-  loadPalette(_currentPalette, palette);
-  if (transitional && _t && progress() < 0xFFFFU) {
+  CRGBPalette16 &curPal = _currentPalette[FX_WORKER_ID]; // WLEDMM palette of the calling render worker
+  const bool inTransition = transitional && _t && progress() < 0xFFFFU;
+#ifdef WLEDMM_PALETTE_CACHE
+  // WLEDMM skip decoding if nothing the palette depends on has changed
+  const bool noBlend = (strip.paletteBlend == 3);
+  const bool volatilePal = inTransition || (palette == 1) || (palette >= 71 && palette <= 74); // random and audio palettes change by themselves
+  // always part of the key: palettes 2-5 are built from the segment colors, and so is palette 0 for some effects (see loadPalette())
+  uint32_t gColors[NUM_COLORS];
+  for (unsigned c = 0; c < NUM_COLORS; c++) gColors[c] = gamma32(colors[c]);
+  if (!volatilePal && _palCache && _palCache->valid && (_palCache->palette == palette) && (_palCache->mode == mode)
+      && (_palCache->noBlend == noBlend) && (_palCache->generation == _paletteGeneration)
+      && (memcmp(_palCache->colors, gColors, sizeof(gColors)) == 0)) {
+    curPal = _palCache->pal16;
+    return;
+  }
+#endif
+  loadPalette(curPal, palette);
+  if (inTransition) {
     // blend palettes
     // there are about 255 blend passes of 48 "blends" to completely blend two palettes (in _dur time)
     // minimum blend time is 100ms maximum is 65535ms
     unsigned long timeMS = millis() - _t->_start;
     uint16_t noOfBlends = (255U * timeMS / _t->_dur) - _t->_prevPaletteBlends;
-    for (unsigned i = 0; i < noOfBlends; i++, _t->_prevPaletteBlends++) nblendPaletteTowardPalette(_t->_palT, _currentPalette, 48);
-    _currentPalette = _t->_palT; // copy transitioning/temporary palette
+    for (unsigned i = 0; i < noOfBlends; i++, _t->_prevPaletteBlends++) nblendPaletteTowardPalette(_t->_palT, curPal, 48);
+    curPal = _t->_palT; // copy transitioning/temporary palette
   }
+#ifdef WLEDMM_PALETTE_CACHE
+  updatePaletteCache(curPal, gColors, noBlend, volatilePal);
+#endif
+}
+
+// WLEDMM re-expand the parts of the 256-entry table that depend on changed palette entries.
+// Each block of 16 table entries is interpolated from palette entries k and k+1, so during transitions only some blocks need an update.
+void Segment::updatePaletteCache(const CRGBPalette16 &pal, const uint32_t *gColors, bool noBlend, bool volatilePal) {
+#ifdef WLEDMM_PALETTE_CACHE
+  if (_palCache == nullptr) {
+    _palCache = (seg_palcache_t*) malloc(sizeof(seg_palcache_t));
+    if (_palCache == nullptr) return; // no problem - color_from_palette() will use FastLED
+    _palCache->valid = false;
+  }
+  uint16_t dirty = 0xFFFFU; // one bit per block
+  if (_palCache->valid && (_palCache->noBlend == noBlend)) {
+    dirty = 0;
+    for (unsigned k = 0; k < 16; k++) if (pal[k] != _palCache->pal16[k]) {
+      dirty |= 1U << k;                              // block k starts at entry k
+      if (!noBlend) dirty |= 1U << ((k + 15) & 0x0F); // block k-1 blends towards entry k (block 15 towards entry 0)
+    }
+  }
+  // a palette that keeps changing is only worth expanding if the segment does more lookups than that costs
+  if (dirty && volatilePal && (__builtin_popcount(dirty) * 16U > virtualLength())) {
+    _palCache->valid = false;
+    return;
+  }
+  for (unsigned blk = 0; blk < 16; blk++) {
+    if (!(dirty & (1U << blk))) continue;
+    for (unsigned i = blk * 16; i < blk * 16 + 16; i++) {
+      CRGB c = ColorFromPalette(pal, i, 255, noBlend ? NOBLEND : LINEARBLEND);
+      _palCache->entries[i] = RGBW32(c.r, c.g, c.b, 0);
+    }
+  }
+  _palCache->pal16      = pal;
+  _palCache->palette    = palette;
+  _palCache->mode       = mode;
+  _palCache->noBlend    = noBlend;
+  _palCache->generation = _paletteGeneration;
+  memcpy(_palCache->colors, gColors, sizeof(_palCache->colors));
+  _palCache->valid      = true;
+#endif
 }
 
 void Segment::handleTransition() {
@@ -520,10 +630,70 @@ void Segment::setUp(uint16_t i1, uint16_t i2, uint8_t grp, uint8_t spc, uint16_t
     spacing = spc;
   }
   if (ofs < UINT16_MAX) offset = ofs;
+  deletePixelMap(); // WLEDMM geometry has changed
   markForReset();
   if (!boundsUnchanged) refreshLightCapabilities();
 }
 
+// WLEDMM build table of physical (bus) indices for each virtual pixel of a 1D segment.
+// Resolves grouping, spacing, reverse, mirror, offset wrap and ledmap once, so setPixelColor() only walks the table.
+// Only called from strip.service(), so the table never gets replaced while an effect is drawing.
+void Segment::updatePixelMap() {
+#ifdef WLEDMM_SEGMENT_PIXELMAP
+  if (pixelMapValid()) return; // nothing changed
+  deletePixelMap();
+  if (!isActive() || (grouping == 0)) return;
+#ifndef WLED_DISABLE_2D
+  if (is2D()) return; // 2D segments take the XY path
+  if (Segment::maxHeight!=1 && (width()==1 || height()==1) && (start < Segment::maxWidth*Segment::maxHeight)) return; // 1D segment inside matrix
+#endif
+
+  const uint_fast16_t vLen   = virtualLength();
+  const uint_fast16_t stride = grouping * (mirror ? 2 : 1);
+  const size_t entries = vLen * stride;
+  if ((entries == 0) || (entries > 2*MAX_LEDS)) return;
+  _pixelMap = (seg_pixelmap_t*) malloc(sizeof(seg_pixelmap_t) + entries * sizeof(uint16_t));
+  if (_pixelMap == nullptr) return; // no problem - setPixelColor() will use the slow path
+
+  const uint16_t len = length();
+  const uint16_t stripLen = strip.getLength();
+  for (uint_fast16_t v = 0; v < vLen; v++) {
+    uint16_t *idx = &_pixelMap->index[v * stride];
+    for (uint_fast16_t k = 0; k < stride; k++) idx[k] = 0xFFFFU;
+    // same arithmetic as the slow path of setPixelColor()
+    int i = v * groupLength();
+    if (reverse) i = mirror ? (len - 1) / 2 - i : (len - 1) - i;
+    i += start;
+    unsigned k = 0;
+    for (int j = 0; j < grouping; j++) {
+      uint16_t indexSet = i + ((reverse) ? -j : j);
+      if (indexSet >= start && indexSet < stop) {
+        if (mirror) {
+          uint16_t indexMir = stop - indexSet + start - 1;
+          indexMir += offset;
+          if (indexMir >= stop) indexMir -= len;
+          uint16_t phys = strip.getMappedPixelIndex(indexMir);
+          if (phys < stripLen) idx[k++] = phys;
+        }
+        indexSet += offset;
+        if (indexSet >= stop) indexSet -= len;
+        uint16_t phys = strip.getMappedPixelIndex(indexSet);
+        if (phys < stripLen) idx[k++] = phys;
+      }
+    }
+  }
+  _pixelMap->start    = start;
+  _pixelMap->stop     = stop;
+  _pixelMap->offset   = offset;
+  _pixelMap->grouping = grouping;
+  _pixelMap->spacing  = spacing;
+  _pixelMap->flags    = options & (REVERSE | MIRROR);
+  _pixelMap->generation = _pixelMapGeneration;
+  _pixelMap->stride   = stride;
+  _pixelMap->vLength  = vLen;
+#endif
+}
+
 
 bool Segment::setColor(uint8_t slot, uint32_t c) { //returns true if changed
   if (slot >= NUM_COLORS || c == colors[slot]) return false;
@@ -642,15 +812,64 @@ uint16_t Segment::nrOfVStrips() const {
   return vLen;
 }
 
+// WLEDMM CRC32 (IEEE 802.3), continuing from a previous result (start with 0). ESP32 uses the ROM routine, other
+// targets a 16 entry table (two lookups per byte, no 1KB table in RAM on 8266).
+static uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t len) {
+#ifdef ARDUINO_ARCH_ESP32
+  return esp_rom_crc32_le(crc, data, len);
+#else
+  static const uint32_t crcNibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  crc = ~crc;
+  for (size_t k = 0; k < len; k++) {
+    crc = (crc >> 4) ^ crcNibble[(crc ^ data[k]) & 0x0F];
+    crc = (crc >> 4) ^ crcNibble[(crc ^ (data[k] >> 4)) & 0x0F];
+  }
+  return ~crc;
+#endif
+}
+
+// WLEDMM size of a .json map source, 0 if there is none. Compiled maps store size and CRC32 of their source; the size is
+// compared first, so the file only has to be read (mapSourceCrc) when the size still matches or when compiling.
+static uint32_t mapSourceSize(const char *fileName) {
+  if (!WLED_FS.exists(fileName)) return 0;
+  File f = WLED_FS.open(fileName, "r");
+  if (!f) return 0;
+  const uint32_t size = f.size();
+  f.close();
+  return size;
+}
+
+// WLEDMM CRC32 of a .json map source - catches edits that keep the size
+static uint32_t mapSourceCrc(const char *fileName) {
+  File f = WLED_FS.open(fileName, "r");
+  if (!f) return 0;
+  uint32_t crc = 0;
+  uint8_t buf[256];
+  int len;
+  while ((len = f.read(buf, sizeof(buf))) > 0) crc = crc32Update(crc, buf, len);
+  f.close();
+  return crc;
+}
+
 //WLEDMM jMap
-struct XandY {
-  uint8_t x;
-  uint8_t y;
-};
-struct ArrayAndSize {
-  uint8_t size;
-  XandY *array;
-};
+// Compiled jMap ("/<segment name>.jmap"), generated from "/<segment name>.json" on first load.
+// Layout: header, (count+1) uint16 offsets into the point list, then numPoints x/y pairs (uint8, or uint16 if wide).
+// The file image is loaded with a single allocation and rendered from directly.
+#define JMAP_BIN_MAGIC 0x324D4A57 // "WJM2"
+typedef struct JMapBinHeader {
+  uint32_t magic;       // JMAP_BIN_MAGIC
+  uint32_t srcSize;     // size of the .json source at compile time, 0 = no source
+  uint32_t srcCrc;      // CRC32 of the .json source at compile time
+  uint16_t count;       // number of virtual pixels
+  uint16_t numPoints;   // total number of x/y points
+  uint16_t width;       // max x + 1
+  uint16_t height;      // max y + 1
+  uint8_t  wide;        // 1 = points are uint16 pairs
+  uint8_t  reserved[3];
+} jmap_bin_t;
+
 class JMapC {
   public:
     char previousSegmentName[50] = "";
@@ -660,118 +879,188 @@ class JMapC {
       deletejVectorMap();
     }
     void deletejVectorMap() {
-      if (jVectorMap.size() > 0) {
-        DEBUG_PRINTLN("delete jVectorMap");
-        for (size_t i=0; i<jVectorMap.size(); i++)
-          if (jVectorMap[i].array) { delete[] jVectorMap[i].array; jVectorMap[i].array = nullptr; } // softhack007 quickfix for memory leak
-        jVectorMap.clear();
+      if (jBin) {
+        DEBUG_PRINTLN("delete jMap image");
+        free(jBin); jBin = nullptr;
       }
     }
     uint16_t length() {
       updatejMapDoc();
-      size_t size = jVectorMap.size();
-      if (size > 0)
-        return size;
+      if (jBin && jBin->count > 0)
+        return jBin->count;
       else
         return SEGMENT.virtualWidth() * SEGMENT.virtualHeight(); //pixels
     }
     void setPixelColor(uint16_t i, uint32_t col) {
       updatejMapDoc();
-      if (jVectorMap.size() > i) {
+      if (jBin && (jBin->count > i)) {
         if (i==0) {
           SEGMENT.fadeToBlackBy(10); //as not all pixels used
         }
-        for (int j=0; j<jVectorMap[i].size; j++) {
-          SEGMENT.setPixelColorXY(jVectorMap[i].array[j].x * scale, jVectorMap[i].array[j].y * scale, col);
+        const uint16_t *offsets = (const uint16_t*)(jBin + 1);
+        for (unsigned j = offsets[i]; j < offsets[i+1]; j++) {
+          uint16_t x, y;
+          getPoint(j, x, y);
+          SEGMENT.setPixelColorXY(x * scale, y * scale, col);
         }
       }
     }
     uint32_t getPixelColor(uint16_t i) {
       updatejMapDoc();
-      if (jVectorMap.size() > 0)
-        return SEGMENT.getPixelColorXY(jVectorMap[i].array[0].x * scale, jVectorMap[i].array[0].y * scale);
+      if (jBin && (jBin->count > i)) {
+        const uint16_t *offsets = (const uint16_t*)(jBin + 1);
+        if (offsets[i+1] == offsets[i]) return 0;
+        uint16_t x, y;
+        getPoint(offsets[i], x, y);
+        return SEGMENT.getPixelColorXY(x * scale, y * scale);
+      }
       else
         return 0;
     }
   private:
-    std::vector<ArrayAndSize> jVectorMap; 
-    StaticJsonDocument<4096> docChunk; //must fit forks with about 32 points each
+    jmap_bin_t *jBin = nullptr; // header + offsets + points, one allocation
     uint8_t scale;
 
-    void updatejMapDoc() {
-      if (SEGMENT.name == nullptr && jVectorMap.size() > 0) {
-        deletejVectorMap();
+    inline void getPoint(unsigned j, uint16_t &x, uint16_t &y) const {
+      const uint8_t *points = (const uint8_t*)(jBin + 1) + (jBin->count + 1) * sizeof(uint16_t);
+      if (jBin->wide) { x = ((const uint16_t*)points)[2*j]; y = ((const uint16_t*)points)[2*j+1]; }
+      else            { x = points[2*j]; y = points[2*j+1]; }
+    }
+    static size_t imageSize(const jmap_bin_t &h) {
+      return sizeof(jmap_bin_t) + (h.count + 1) * sizeof(uint16_t) + h.numPoints * 2 * (h.wide ? sizeof(uint16_t) : sizeof(uint8_t));
+    }
+
+    // read a compiled jMap; fails if missing, damaged or not compiled from the current .json source (size first, then CRC)
+    bool loadBinary(const char *binFileName, const char *jsonFileName, uint32_t srcSize) {
+      if (!WLED_FS.exists(binFileName)) return false;
+      File binFile = WLED_FS.open(binFileName, "r");
+      if (!binFile) return false;
+      jmap_bin_t header;
+      bool ok = (binFile.read((uint8_t*)&header, sizeof(header)) == sizeof(header)) && (header.magic == JMAP_BIN_MAGIC)
+             && (binFile.size() == imageSize(header))
+             && ((srcSize == 0) || ((header.srcSize == srcSize) && (header.srcCrc == mapSourceCrc(jsonFileName))));
+      if (ok) {
+        jBin = (jmap_bin_t*) malloc(imageSize(header));
+        if (jBin) {
+          memcpy(jBin, &header, sizeof(header));
+          size_t rest = imageSize(header) - sizeof(header);
+          if (binFile.read((uint8_t*)(jBin + 1), rest) != rest) deletejVectorMap();
+        }
+        ok = (jBin != nullptr);
       }
-      else if (SEGMENT.name != nullptr && strcmp(SEGMENT.name, previousSegmentName) != 0) {
-        uint32_t dataSize = 0;
-        deletejVectorMap();
-        DEBUG_PRINT("New "); DEBUG_PRINTLN(SEGMENT.name);
-        char jMapFileName[50];
-        strcpy(jMapFileName, "/");
-        strcat(jMapFileName, SEGMENT.name);
-        strcat(jMapFileName, ".json");
-        File jMapFile;
-        jMapFile = WLED_FS.open(jMapFileName, "r");
-
-        uint_fast16_t maxWidth = 0;       // WLEDMM fix uint8 overflow for large width/height
-        uint_fast16_t maxHeight = 0;      // WLEDMM
-
-        //https://arduinojson.org/v6/how-to/deserialize-a-very-large-document/
-        jMapFile.find("[");
-        do { //for each element in the array
-          DeserializationError err = deserializeJson(docChunk, jMapFile);
-          // serializeJson(docChunk, Serial); USER_PRINTLN();
-          // USER_PRINTF("docChunk  %u / %u%% (%u %u %u) %u\n", (unsigned int)docChunk.memoryUsage(), 100 * docChunk.memoryUsage() / docChunk.capacity(), (unsigned int)docChunk.size(), docChunk.overflowed(), (unsigned int)docChunk.nesting(), jMapFile.size());
-          if (err) 
-          {
-            USER_PRINTF("deserializeJson() of parseTree failed with code %s\n", err.c_str());
-            USER_FLUSH();
-            if (SEGMENT.name) delete[] SEGMENT.name; SEGMENT.name = nullptr; //need to clear the name as otherwise continuously loaded // softhack007 avoid deleting nullptr
-            return;
-          }
+      binFile.close();
+      if (!ok) DEBUG_PRINTF("jMap: %s is outdated or damaged.\n", binFileName);
+      return ok;
+    }
 
-          if (docChunk.is<JsonArray>()) { //each item is or an array of arrays (fork) or an array of x,y (no fork)
-            //fill the vector with arrays and get the width and height of the jMap
-
-            JsonArray arrayChunk = docChunk.as<JsonArray>();
-            ArrayAndSize arrayAndSize;
-            arrayAndSize.size = 0;
-            if (arrayChunk[0].is<JsonArray>()) { //if array of arrays
-              arrayAndSize.array = new XandY[arrayChunk.size()];
-              for (JsonVariant arrayElement: arrayChunk) {
-                maxWidth = max((uint16_t)maxWidth, arrayElement[0].as<uint16_t>());       // WLEDMM use native min/max
-                maxHeight = max((uint16_t)maxHeight, arrayElement[1].as<uint16_t>());     // WLEDMM
-                arrayAndSize.array[arrayAndSize.size].x = arrayElement[0].as<uint8_t>();
-                arrayAndSize.array[arrayAndSize.size].y = arrayElement[1].as<uint8_t>();
-                arrayAndSize.size++;
-                dataSize += sizeof(XandY);
-              }
-            }
-            else { // if array (of x and y)
-              arrayAndSize.array = new XandY[1];
-              maxWidth = max((uint16_t)maxWidth, arrayChunk[0].as<uint16_t>());         // WLEDMM use native min/max
-              maxHeight = max((uint16_t)maxHeight, arrayChunk[1].as<uint16_t>());       // WLEDMM
-              arrayAndSize.array[arrayAndSize.size].x = arrayChunk[0].as<uint8_t>();
-              arrayAndSize.array[arrayAndSize.size].y = arrayChunk[1].as<uint8_t>();
-              arrayAndSize.size++;
-              dataSize += sizeof(XandY);
+    // stream-parse the .json jMap, build the compiled image and store it as .jmap for the next boot
+    bool compileJson(const char *jsonFileName, const char *binFileName) {
+      const uint32_t srcCrc = mapSourceCrc(jsonFileName);
+      File jMapFile = WLED_FS.open(jsonFileName, "r");
+      if (!jMapFile) return false;
+      const uint32_t srcSize = jMapFile.size();
+
+      std::vector<uint16_t> offsets;    // temporary - freed after compiling
+      std::vector<uint16_t> points;
+      uint_fast16_t maxWidth = 0;       // WLEDMM fix uint8 overflow for large width/height
+      uint_fast16_t maxHeight = 0;      // WLEDMM
+
+      { // docChunk only lives while parsing
+      DynamicJsonDocument docChunk(4096); //must fit forks with about 32 points each
+      //https://arduinojson.org/v6/how-to/deserialize-a-very-large-document/
+      jMapFile.find("[");
+      do { //for each element in the array
+        DeserializationError err = deserializeJson(docChunk, jMapFile);
+        if (err)
+        {
+          USER_PRINTF("deserializeJson() of parseTree failed with code %s\n", err.c_str());
+          USER_FLUSH();
+          jMapFile.close();
+          return false;
+        }
+
+        if (docChunk.is<JsonArray>()) { //each item is or an array of arrays (fork) or an array of x,y (no fork)
+          JsonArray arrayChunk = docChunk.as<JsonArray>();
+          offsets.push_back(points.size() / 2);
+          if (arrayChunk[0].is<JsonArray>()) { //if array of arrays
+            for (JsonVariant arrayElement: arrayChunk) {
+              uint16_t x = arrayElement[0].as<uint16_t>();
+              uint16_t y = arrayElement[1].as<uint16_t>();
+              maxWidth = max((uint16_t)maxWidth, x);       // WLEDMM use native min/max
+              maxHeight = max((uint16_t)maxHeight, y);     // WLEDMM
+              points.push_back(x); points.push_back(y);
             }
-            jVectorMap.push_back(arrayAndSize);
-            dataSize += sizeof(arrayAndSize);
           }
+          else { // if array (of x and y)
+            uint16_t x = arrayChunk[0].as<uint16_t>();
+            uint16_t y = arrayChunk[1].as<uint16_t>();
+            maxWidth = max((uint16_t)maxWidth, x);         // WLEDMM use native min/max
+            maxHeight = max((uint16_t)maxHeight, y);       // WLEDMM
+            points.push_back(x); points.push_back(y);
+          }
+        }
+      } while (jMapFile.findUntil(",", "]") && (offsets.size() < UINT16_MAX) && (points.size() < 2*UINT16_MAX));
+      }
+      jMapFile.close();
+
+      jmap_bin_t header;
+      memset(&header, 0, sizeof(header));
+      header.magic     = JMAP_BIN_MAGIC;
+      header.srcSize   = srcSize;
+      header.srcCrc    = srcCrc;
+      header.count     = offsets.size();
+      header.numPoints = min(points.size() / 2, size_t(UINT16_MAX));
+      header.width     = maxWidth + 1;
+      header.height    = maxHeight + 1;
+      header.wide      = (maxWidth > 255) || (maxHeight > 255);
+      offsets.push_back(header.numPoints);
+
+      jBin = (jmap_bin_t*) malloc(imageSize(header));
+      if (jBin == nullptr) {
+        USER_PRINTLN(F("jMap: not enough memory."));
+        return false;
+      }
+      memcpy(jBin, &header, sizeof(header));
+      memcpy(jBin + 1, offsets.data(), offsets.size() * sizeof(uint16_t));
+      uint8_t *pts = (uint8_t*)(jBin + 1) + offsets.size() * sizeof(uint16_t);
+      for (unsigned j = 0; j < 2U * header.numPoints; j++) {
+        if (header.wide) ((uint16_t*)pts)[j] = points[j];
+        else pts[j] = points[j];
+      }
 
-        } while (jMapFile.findUntil(",", "]"));
+      File binFile = WLED_FS.open(binFileName, "w");
+      if (binFile) {
+        binFile.write((const uint8_t*)jBin, imageSize(header));
+        binFile.close();
+        invalidateFileNameCache();
+      }
+      return true;
+    }
 
-        jMapFile.close();
+    void updatejMapDoc() {
+      if (SEGMENT.name == nullptr && jBin) {
+        deletejVectorMap();
+      }
+      else if (SEGMENT.name != nullptr && strcmp(SEGMENT.name, previousSegmentName) != 0) {
+        deletejVectorMap();
+        DEBUG_PRINT("New "); DEBUG_PRINTLN(SEGMENT.name);
+        char jMapFileName[56];
+        char binFileName[56];
+        snprintf(jMapFileName, sizeof(jMapFileName), "/%s.json", SEGMENT.name);
+        snprintf(binFileName, sizeof(binFileName), "/%s.jmap", SEGMENT.name);
+
+        const uint32_t srcSize = mapSourceSize(jMapFileName);
+        if (!loadBinary(binFileName, jMapFileName, srcSize) && ((srcSize == 0) || !compileJson(jMapFileName, binFileName))) {
+          if (SEGMENT.name) delete[] SEGMENT.name; SEGMENT.name = nullptr; //need to clear the name as otherwise continuously loaded // softhack007 avoid deleting nullptr
+          return;
+        }
 
-        maxWidth++; maxHeight++;
-        scale = min(SEGMENT.virtualWidth() / maxWidth, SEGMENT.virtualHeight() / maxHeight);  // WLEDMM use native min/max
-        dataSize += sizeof(jVectorMap);
+        scale = min(SEGMENT.virtualWidth() / jBin->width, SEGMENT.virtualHeight() / jBin->height);  // WLEDMM use native min/max
         USER_PRINT("dataSize ");
-        USER_PRINT(dataSize);
+        USER_PRINT(imageSize(*jBin));
         USER_PRINT(" scale ");
         USER_PRINTLN(scale);
-        strcpy(previousSegmentName, SEGMENT.name);
+        strlcpy(previousSegmentName, SEGMENT.name, sizeof(previousSegmentName));
       }
     } //updatejMapDoc
 }; //class JMapC
@@ -828,6 +1117,37 @@ static int getPinwheelLength(int vW, int vH) {
   // else
   return Pinwheel_Steps_XL;
 }
+// WLEDMM Pinwheel helper function: cos/sin of ray i. The values only depend on the ray count, so they are computed once
+// per pinwheel size (max 368 rays) instead of calling cosf()/sinf() on every pixel access.
+static void getPinwheelRay(int i, int vW, int vH, float &cosVal, float &sinVal) {
+  typedef struct { float cosVal; float sinVal; } pinwheel_ray_t;
+  static pinwheel_ray_t* rays[4] = {nullptr};
+  const int steps = getPinwheelLength(vW, vH);
+  const int slot = (steps == Pinwheel_Steps_Small) ? 0 : (steps == Pinwheel_Steps_Medium) ? 1 : (steps == Pinwheel_Steps_Big) ? 2 : 3;
+  const pinwheel_ray_t *table = __atomic_load_n(&rays[slot], __ATOMIC_ACQUIRE); // sees the table contents if it sees the pointer
+  if ((table == nullptr) && (i >= 0) && (i < steps)) {
+    pinwheel_ray_t *r = (pinwheel_ray_t*) malloc(sizeof(pinwheel_ray_t) * steps);
+    if (r) {
+      for (int n = 0; n < steps; n++) {
+        float angleRad = getPinwheelAngle(n, vW, vH); // angle in radians
+        r[n].cosVal = cosf(angleRad);
+        r[n].sinVal = sinf(angleRad);
+      }
+      // publish; if the other render worker was faster, use its table and drop ours
+      pinwheel_ray_t *expected = nullptr;
+      if (__atomic_compare_exchange_n(&rays[slot], &expected, r, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) table = r;
+      else { free(r); table = expected; }
+    }
+  }
+  if (table && (i >= 0) && (i < steps)) {
+    cosVal = table[i].cosVal;
+    sinVal = table[i].sinVal;
+    return;
+  }
+  float angleRad = getPinwheelAngle(i, vW, vH); // angle in radians
+  cosVal = cosf(angleRad);
+  sinVal = sinf(angleRad);
+}
 #endif
 
 // 1D strip
@@ -898,6 +1218,161 @@ void xyFromBlock(uint16_t &x,uint16_t &y, uint16_t i, uint16_t vW, uint16_t vH,
 
 }
 
+#ifndef WLED_DISABLE_2D
+// WLEDMM expand virtual pixel i of the pArc, sCircle, sBlock or sPinwheel mapping (without virtual strips) into XY cells.
+// Shared by setPixelColor() and updateXYList(), so replaying a precompiled list paints exactly the same cells.
+// Cells may fall outside of the segment, setPixelColorXY() will clip them.
+// skipCenter: pinwheel only, start an odd ray further from the center (see Segment::pinwheelSkipsCenter()).
+template <typename F>
+static void expand1Dto2D(uint8_t map1D2D, int i, int vW, int vH, F emit, bool skipCenter = false) {
+  switch (map1D2D) {
+    case M12_pArc:
+      if (i==0)
+        emit(0, 0);
+      else {
+        //WLEDMM: some optimizations for the drawing loop
+        //  pre-calculate loop limits, exploit symmetry at 45deg
+        float radius = float(i);
+        // float step = HALF_PI / (2.85f * radius);  // upstream uses this
+        float step = HALF_PI / (M_PI * radius);      // WLEDMM we use the correct circumference
+        bool useSymmetry = (max(vH, vW) > 20);       // for segments wider than 20 pixels, we exploit symmetry
+        unsigned numSteps;
+        if (useSymmetry) numSteps = 1 + ((HALF_PI/2.0f + step/2.0f) / step); // with symmetry
+        else             numSteps = 1 + ((HALF_PI      + step/2.0f) / step); // without symmetry
+
+        float rad = 0.0f;
+        for (unsigned count = 0; count < numSteps; count++) {
+          int x = roundf(sinf(rad) * radius);
+          int y = roundf(cosf(rad) * radius);
+          emit(x, y);
+          if(useSymmetry) emit(y, x);// WLEDMM
+          rad += step;
+        }
+      }
+      break;
+    case M12_sCircle: { // circle of radius i/2 around the center - same test as drawArc()
+      const int x0 = vW/2;
+      const int y0 = vH/2;
+      const uint16_t radius = i/2;
+      float minradius = radius - .5;
+      float maxradius = radius + .5;
+      for (int x=0; x<vW; x++) for (int y=0; y<vH; y++) {
+        int newX = x - x0;
+        int newY = y - y0;
+        if (newX*newX + newY*newY >= minradius * minradius && newX*newX + newY*newY <= maxradius * maxradius) emit(x, y);
+      }
+      break;
+    }
+    case M12_sBlock: // block outline around the center
+      for (int x = vW / 2 - i - 1; x <= vW / 2 + i; x++) { // top and bottom horizontal lines
+        emit(x, vH / 2 - i - 1);
+        emit(x, vH / 2 + i    );
+      }
+      for (int y = vH / 2 - i - 1 + 1; y <= vH / 2 + i - 1; y++) { //left and right vertical lines
+        emit(vW / 2 - i - 1, y);
+        emit(vW / 2 + i    , y);
+      }
+      break;
+    case M12_sPinwheel: {
+      float centerX = roundf((vW-1) / 2.0f);
+      float centerY = roundf((vH-1) / 2.0f);
+      float cosVal, sinVal;
+      getPinwheelRay(i, vW, vH, cosVal, sinVal); // WLEDMM precomputed
+
+      // avoid re-painting the same pixel
+      int lastX = INT_MIN; // impossible position
+      int lastY = INT_MIN; // impossible position
+      // draw line at angle, starting at center and ending at the segment edge
+      // we use fixed point math for better speed. Starting distance is 0.5 for better rounding
+      // int_fast16_t and int_fast32_t types changed to int, minimum bits commented
+      int posx = (centerX + 0.5f * cosVal) * Fixed_Scale; // X starting position in fixed point 18 bit
+      int posy = (centerY + 0.5f * sinVal) * Fixed_Scale; // Y starting position in fixed point 18 bit
+      int inc_x = cosVal * Fixed_Scale; // X increment per step (fixed point) 10 bit
+      int inc_y = sinVal * Fixed_Scale; // Y increment per step (fixed point) 10 bit
+
+      int32_t maxX = vW * Fixed_Scale; // X edge in fixedpoint
+      int32_t maxY = vH * Fixed_Scale; // Y edge in fixedpoint
+
+      // Odd rays start further from center if prevRay started at center.
+      if (skipCenter) {
+        int jump = min(vW/3, vH/3); // can add 2 if using medium pinwheel
+        posx += inc_x * jump;
+        posy += inc_y * jump;
+      }
+
+      // draw ray until we hit any edge
+      while ((posx >= 0) && (posy >= 0) && (posx < maxX)  && (posy < maxY))  {
+        // scale down to integer (compiler will replace division with appropriate bitshift)
+        int x = posx / Fixed_Scale;
+        int y = posy / Fixed_Scale;
+        if (x != lastX || y != lastY) emit(x, y);  // only paint if pixel position is different
+        lastX = x;
+        lastY = y;
+        // advance to next position
+        posx += inc_x;
+        posy += inc_y;
+      }
+      break;
+    }
+  }
+}
+#endif
+
+// WLEDMM compile the pArc, sCircle, sBlock and sPinwheel 1D->2D expansions into a list of XY cells per virtual pixel.
+// These mappings need trigonometry (or a full matrix scan for sCircle) for each pixel, so setPixelColor() replays the list instead.
+// Only called from strip.service(), so the list never gets replaced while an effect is drawing.
+void Segment::updateXYList() {
+#ifdef WLEDMM_SEGMENT_XYLIST
+  const bool needsList = isActive() && is2D()
+                      && ((map1D2D == M12_pArc) || (map1D2D == M12_sCircle) || (map1D2D == M12_sBlock) || (map1D2D == M12_sPinwheel));
+  if (!needsList) { deleteXYList(); return; }
+  const uint_fast16_t vLen = virtualLength();
+  if (xyListValid() && ((_xyList->vLength == vLen) || (_xyList->numCells == 0))) return; // nothing changed
+  deleteXYList();
+
+  const int vW = virtualWidth();
+  const int vH = virtualHeight();
+  size_t numCells = 0;
+  for (uint_fast16_t v = 0; v < vLen; v++)
+    expand1Dto2D(map1D2D, v, vW, vH, [&](int x, int y) { if ((x >= 0) && (y >= 0) && (x < vW) && (y < vH)) numCells++; });
+
+  if ((numCells == 0) || (numCells > XYLIST_MAX_CELLS)) {
+    // too large - keep an empty list, so we don't try again on every frame. setPixelColor() will expand on the fly.
+    _xyList = (seg_xylist_t*) malloc(sizeof(seg_xylist_t));
+    if (_xyList) _xyList->vLength = 0;
+    numCells = 0;
+  } else {
+    _xyList = (seg_xylist_t*) malloc(sizeof(seg_xylist_t) + (2*vLen + 1 + 2*numCells) * sizeof(uint16_t));
+    if (_xyList == nullptr) return; // no problem - setPixelColor() will expand on the fly
+    uint16_t *runs  = _xyList->data;
+    uint16_t *skips = &_xyList->data[vLen + 1];
+    uint16_t *cells = &_xyList->data[2*vLen + 1];
+    unsigned n = 0;
+    for (uint_fast16_t v = 0; v < vLen; v++) {
+      runs[v] = n;
+      expand1Dto2D(map1D2D, v, vW, vH, [&](int x, int y) {
+        if ((x >= 0) && (y >= 0) && (x < vW) && (y < vH)) { cells[2*n] = x; cells[2*n+1] = y; n++; }
+      });
+      // a pinwheel ray that skips the center walks the same positions from a later step, so it is the tail of the full ray
+      unsigned tail = n - runs[v];
+      if ((map1D2D == M12_sPinwheel) && (v % 2 == 1)) {
+        tail = 0;
+        expand1Dto2D(map1D2D, v, vW, vH, [&](int, int) { tail++; }, true);
+      }
+      skips[v] = n - runs[v] - tail;
+    }
+    runs[vLen] = n;
+    _xyList->vLength = vLen;
+  }
+  if (_xyList == nullptr) return;
+  _xyList->width    = vW;
+  _xyList->height   = vH;
+  _xyList->map1D2D  = map1D2D;
+  _xyList->numCells = numCells;
+  if (numCells > 0) DEBUG_PRINTF("updateXYList: %u cells for %u pixels (%ux%u).\n", unsigned(numCells), unsigned(vLen), unsigned(vW), unsigned(vH));
+#endif
+}
+
 void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATTR conditionally
 {
   if (!isActive()) return; // not active
@@ -910,6 +1385,15 @@ void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATT
 
 #ifndef WLED_DISABLE_2D
   if (is2D()) {
+#ifdef WLEDMM_SEGMENT_XYLIST
+    if ((vStrip == 0) && xyListValid() && (i < _xyList->vLength)) { // WLEDMM fast path - replay precompiled cells
+      const uint16_t *cells = &_xyList->data[2*_xyList->vLength + 1];
+      unsigned k = _xyList->data[i];
+      if ((map1D2D == M12_sPinwheel) && pinwheelSkipsCenter(i)) k += _xyList->data[_xyList->vLength + 1 + i];
+      for (; k < _xyList->data[i+1]; k++) setPixelColorXY(int(cells[2*k]), int(cells[2*k+1]), col);
+      return;
+    }
+#endif
     uint16_t vH = virtualHeight();  // segment height in logical pixels
     uint16_t vW = virtualWidth();
     switch (map1D2D) {
@@ -924,46 +1408,7 @@ void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATT
         break;
       case M12_pArc:
         // expand in circular fashion from center
-        if (i==0)
-          setPixelColorXY(0, 0, col);
-        else {
-          //WLEDMM: drawArc(0, 0, i, col); could work as alternative
-
-          //WLEDMM: some optimizations for the drawing loop
-          //  pre-calculate loop limits, exploit symmetry at 45deg
-          float radius = float(i);
-          // float step = HALF_PI / (2.85f * radius);  // upstream uses this
-          float step = HALF_PI / (M_PI * radius);      // WLEDMM we use the correct circumference
-          bool useSymmetry = (max(vH, vW) > 20);       // for segments wider than 20 pixels, we exploit symmetry
-          unsigned numSteps;
-          if (useSymmetry) numSteps = 1 + ((HALF_PI/2.0f + step/2.0f) / step); // with symmetry
-          else             numSteps = 1 + ((HALF_PI      + step/2.0f) / step); // without symmetry
-
-          float rad = 0.0f;
-          for (unsigned count = 0; count < numSteps; count++) {
-            // may want to try float version as well (with or without antialiasing)
-            int x = roundf(sinf(rad) * radius);
-            int y = roundf(cosf(rad) * radius);
-            setPixelColorXY(x, y, col);
-            if(useSymmetry) setPixelColorXY(y, x, col);// WLEDMM
-            rad += step;
-          }
-
-          // Bresenham’s Algorithm (may not fill every pixel)
-          //int d = 3 - (2*i);
-          //int y = i, x = 0;
-          //while (y >= x) {
-          //  setPixelColorXY(x, y, col);
-          //  setPixelColorXY(y, x, col);
-          //  x++;
-          //  if (d > 0) {
-          //    y--;
-          //    d += 4 * (x - y) + 10;
-          //  } else {
-          //    d += 4 * x + 6;
-          //  }
-          //}
-        }
+        expand1Dto2D(map1D2D, i, vW, vH, [&](int x, int y) { setPixelColorXY(x, y, col); });
         break;
       case M12_pCorner:
         for (int x = 0; x <= i; x++) setPixelColorXY(x, i, col);
@@ -981,7 +1426,7 @@ void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATT
           setPixelColorXY(x + vW/2, y + vH/2, col);
         }
         else // pArc -> circle
-          drawArc(vW/2, vH/2, i/2, col);
+          expand1Dto2D(map1D2D, i, vW, vH, [&](int x, int y) { setPixelColorXY(x, y, col); });
         break;
       case M12_sBlock: //WLEDMM
         if (vStrip > 0)
@@ -991,63 +1436,13 @@ void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATT
           xyFromBlock(x,y, i, vW, vH, (vStrip+1)*2);
           setPixelColorXY(x, y, col);
         }
-        else { // pCorner -> block
-          for (int x = vW / 2 - i - 1; x <= vW / 2 + i; x++) { // top and bottom horizontal lines
-              setPixelColorXY(x, vH / 2 - i - 1, col);
-              setPixelColorXY(x, vH / 2 + i    , col);
-          }
-          for (int y = vH / 2 - i - 1 + 1; y <= vH / 2 + i - 1; y++) { //left and right vertical lines
-            setPixelColorXY(vW / 2 - i - 1, y, col);
-            setPixelColorXY(vW / 2 + i    , y, col);
-          }
-        }
+        else // pCorner -> block
+          expand1Dto2D(map1D2D, i, vW, vH, [&](int x, int y) { setPixelColorXY(x, y, col); });
         break;
-      case M12_sPinwheel: {
+      case M12_sPinwheel:
         // i = angle --> 0 - 296  (Big), 0 - 192  (Medium), 0 - 72 (Small)
-        float centerX = roundf((vW-1) / 2.0f);
-        float centerY = roundf((vH-1) / 2.0f);
-        float angleRad = getPinwheelAngle(i, vW, vH); // angle in radians
-        float cosVal = cosf(angleRad);
-        float sinVal = sinf(angleRad);
-
-        // avoid re-painting the same pixel
-        int lastX = INT_MIN; // impossible position
-        int lastY = INT_MIN; // impossible position
-        // draw line at angle, starting at center and ending at the segment edge
-        // we use fixed point math for better speed. Starting distance is 0.5 for better rounding
-        // int_fast16_t and int_fast32_t types changed to int, minimum bits commented
-        int posx = (centerX + 0.5f * cosVal) * Fixed_Scale; // X starting position in fixed point 18 bit
-        int posy = (centerY + 0.5f * sinVal) * Fixed_Scale; // Y starting position in fixed point 18 bit
-        int inc_x = cosVal * Fixed_Scale; // X increment per step (fixed point) 10 bit
-        int inc_y = sinVal * Fixed_Scale; // Y increment per step (fixed point) 10 bit
-
-        int32_t maxX = vW * Fixed_Scale; // X edge in fixedpoint
-        int32_t maxY = vH * Fixed_Scale; // Y edge in fixedpoint
-
-        // Odd rays start further from center if prevRay started at center.
-        static int prevRay = INT_MIN; // previous ray number
-        if ((i % 2 == 1) && (i - 1 == prevRay || i + 1 == prevRay)) {
-          int jump = min(vW/3, vH/3); // can add 2 if using medium pinwheel 
-          posx += inc_x * jump;
-          posy += inc_y * jump;
-        }
-        prevRay = i;
-
-        // draw ray until we hit any edge
-        while ((posx >= 0) && (posy >= 0) && (posx < maxX)  && (posy < maxY))  {
-          // scale down to integer (compiler will replace division with appropriate bitshift)
-          int x = posx / Fixed_Scale;
-          int y = posy / Fixed_Scale;
-          // set pixel
-          if (x != lastX || y != lastY) setPixelColorXY(x, y, col);  // only paint if pixel position is different
-          lastX = x;
-          lastY = y;
-          // advance to next position
-          posx += inc_x;
-          posy += inc_y;
-        }
+        expand1Dto2D(map1D2D, i, vW, vH, [&](int x, int y) { setPixelColorXY(x, y, col); }, pinwheelSkipsCenter(i));
         break;
-      }
     }
     return;
   } else if (Segment::maxHeight!=1 && (width()==1 || height()==1)) {
@@ -1071,6 +1466,17 @@ void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATT
     col = color_fade(col, _bri_t);
   }
 
+#ifdef WLEDMM_SEGMENT_PIXELMAP
+  if (pixelMapValid() && (i < _pixelMap->vLength)) { // WLEDMM fast path - walk precomputed physical indices
+    const uint16_t *idx = &_pixelMap->index[i * _pixelMap->stride];
+    for (unsigned k = 0; k < _pixelMap->stride; k++) {
+      if (idx[k] == 0xFFFFU) break; // entries are packed, first empty one ends the list
+      busses.setPixelColor(idx[k], col);
+    }
+    return;
+  }
+#endif
+
   // expand pixel (taking into account start, grouping, spacing [and offset])
   i = i * groupLength();
   if (reverse) { // is segment reversed?
@@ -1110,6 +1516,50 @@ void IRAM_ATTR_YN Segment::setPixelColor(int i, uint32_t col) //WLEDMM: IRAM_ATT
   }
 }
 
+// WLEDMM span version of setPixelColor(), for n consecutive (virtual) pixels starting at "first".
+// Simple 1D segments (no grouping, spacing or mirror) are handed down to the busses in contiguous runs;
+// everything else falls back to single pixel writes.
+void Segment::setPixelColors(int first, const uint32_t *c, unsigned n)
+{
+  if (!isActive() || first < 0 || n == 0) return; // not active
+  const unsigned len = length();
+  bool simpleSegment = !mirror && (grouping == 1) && (spacing == 0) && (offset < len);
+#ifndef WLED_DISABLE_2D
+  if (is2D()) simpleSegment = false;
+  else if (Segment::maxHeight!=1 && (width()==1 || height()==1) && (start < Segment::maxWidth*Segment::maxHeight)) simpleSegment = false; // 1D segment inside a matrix
+#endif
+  if (!simpleSegment) {
+    for (unsigned k = 0; k < n; k++) setPixelColor(first + int(k), c[k]);
+    return;
+  }
+
+  if (unsigned(first) >= len) return;
+  if (first + n > len) n = len - first;
+
+  if (ledsrgb) for (unsigned k = 0; k < n; k++) ledsrgb[first + k] = c[k];
+
+  uint8_t _bri_t = currentBri(on ? opacity : 0);
+  if (!_bri_t && !transitional && fadeTransition) return; // same shortcut as setPixelColor()
+
+  uint32_t tmp[PIXEL_SPAN_CHUNK];
+  while (n > 0) {
+    const unsigned cnt = min(n, unsigned(PIXEL_SPAN_CHUNK));
+    // copy chunk in physical order, applying brightness
+    for (unsigned k = 0; k < cnt; k++) {
+      uint32_t col = c[k];
+      if (_bri_t < 255) col = color_fade(col, _bri_t);
+      tmp[reverse ? cnt-1-k : k] = col;
+    }
+    unsigned i0 = reverse ? len - first - cnt : first; // lowest segment-relative index of this chunk
+    unsigned p0 = start + i0 + offset;                  // offset/phase
+    if (p0 >= stop) p0 -= len;                          // wrap
+    unsigned run = min(cnt, unsigned(stop - p0));
+    strip.setPixelColors(p0, tmp, run);
+    if (run < cnt) strip.setPixelColors(start, tmp + run, cnt - run); // wrapped part
+    first += cnt; c += cnt; n -= cnt;
+  }
+}
+
 // anti-aliased normalized version of setPixelColor()
 void Segment::setPixelColor(float i, uint32_t col, bool aa)
 {
@@ -1120,23 +1570,15 @@ void Segment::setPixelColor(float i, uint32_t col, bool aa)
   if (i<0.0f || i>1.0f) return; // not normalized
 
   float fC = i * (virtualLength()-1);
-  if (aa) {
-    uint16_t iL = roundf(fC-0.49f);
-    uint16_t iR = roundf(fC+0.49f);
-    float    dL = (fC - iL)*(fC - iL);
-    float    dR = (iR - fC)*(iR - fC);
-    uint32_t cIL = getPixelColor(iL | (vStrip<<16));
-    uint32_t cIR = getPixelColor(iR | (vStrip<<16));
-    if (iR!=iL) {
-      // blend L pixel
-      cIL = color_blend(col, cIL, uint8_t(dL*255.0f));
-      setPixelColor(iL | (vStrip<<16), cIL);
-      // blend R pixel
-      cIR = color_blend(col, cIR, uint8_t(dR*255.0f));
-      setPixelColor(iR | (vStrip<<16), cIR);
+  if (aa) { // WLEDMM Q8.8 position, split linearly between the two neighbouring pixels
+    const uint32_t pos = uint32_t(fC * 256.0f + 0.5f);
+    const uint16_t iL = pos >> 8;
+    const uint8_t  f  = pos & 0xFF;
+    if (f == 0) {
+      setPixelColor(iL | (vStrip<<16), col); // exact match (lands on a pixel)
     } else {
-      // exact match (x & y land on a pixel)
-      setPixelColor(iL | (vStrip<<16), col);
+      setPixelColor(iL     | (vStrip<<16), color_blend(getPixelColor(iL     | (vStrip<<16)), col, 255 - f));
+      setPixelColor((iL+1) | (vStrip<<16), color_blend(getPixelColor((iL+1) | (vStrip<<16)), col, f));
     }
   } else {
     setPixelColor(uint16_t(roundf(fC)) | (vStrip<<16), col);
@@ -1195,11 +1637,16 @@ uint32_t Segment::getPixelColor(int i)
       case M12_sPinwheel:
         // not 100% accurate, returns pixel at outer edge
         // i = angle --> 0 - 296  (Big), 0 - 192  (Medium), 0 - 72 (Small)
+#ifdef WLEDMM_SEGMENT_XYLIST
+        if (xyListValid() && (i < _xyList->vLength) && (_xyList->data[i+1] > _xyList->data[i])) { // WLEDMM last cell of the precompiled ray
+          const uint16_t *cell = &_xyList->data[2*_xyList->vLength + 1 + 2*(_xyList->data[i+1] - 1)];
+          return getPixelColorXY(int(cell[0]), int(cell[1]));
+        }
+#endif
         float centerX = roundf((vW-1) / 2.0f);
         float centerY = roundf((vH-1) / 2.0f);
-        float angleRad = getPinwheelAngle(i, vW, vH); // angle in radians
-        float cosVal = cosf(angleRad);
-        float sinVal = sinf(angleRad);
+        float cosVal, sinVal;
+        getPinwheelRay(i, vW, vH, cosVal, sinVal); // WLEDMM precomputed
 
         int posx = (centerX + 0.5f * cosVal) * Fixed_Scale; // X starting position in fixed point 18 bit
         int posy = (centerY + 0.5f * sinVal) * Fixed_Scale; // Y starting position in fixed point 18 bit
@@ -1321,6 +1768,12 @@ void Segment::fill(uint32_t c) {
   if (!isActive()) return; // not active
   const uint_fast16_t cols = is2D() ? virtualWidth() : virtualLength();             // WLEDMM use fast int types
   const uint_fast16_t rows = virtualHeight(); // will be 1 for 1D
+  if (!is2D()) { // WLEDMM 1D: write in spans
+    uint32_t buf[PIXEL_SPAN_CHUNK];
+    for (unsigned k = 0; k < PIXEL_SPAN_CHUNK; k++) buf[k] = c;
+    for (unsigned x = 0; x < cols; x += PIXEL_SPAN_CHUNK) setPixelColors(x, buf, min(unsigned(cols - x), unsigned(PIXEL_SPAN_CHUNK)));
+    return;
+  }
   for(uint_fast16_t y = 0; y < rows; y++) for (uint_fast16_t x = 0; x < cols; x++) {
     if (is2D()) setPixelColorXY((uint16_t)x, (uint16_t)y, c);
     else        setPixelColor((uint16_t)x, c);
@@ -1413,8 +1866,14 @@ void Segment::fadeToBlackBy(uint8_t fadeBy) {
       setPixelColorXY((uint16_t)x, (uint16_t)y, CRGB(getPixelColorXY(x,y)).nscale8(scaledown));
     }
   } else {
-    for (uint_fast16_t x = 0; x < cols; x++) {
-      setPixelColor((uint16_t)x, CRGB(getPixelColor((uint16_t)x)).nscale8(scaledown));
+    uint32_t buf[PIXEL_SPAN_CHUNK]; // WLEDMM 1D: write in spans
+    for (unsigned x = 0; x < cols; x += PIXEL_SPAN_CHUNK) {
+      const unsigned cnt = min(unsigned(cols - x), unsigned(PIXEL_SPAN_CHUNK));
+      for (unsigned k = 0; k < cnt; k++) {
+        CRGB pix = CRGB(getPixelColor(int(x + k))).nscale8(scaledown);
+        buf[k] = RGBW32(pix.r, pix.g, pix.b, 0);
+      }
+      setPixelColors(x, buf, cnt);
     }
   }
 }
@@ -1427,10 +1886,7 @@ void Segment::blur(uint8_t blur_amount, bool smear) {
 #ifndef WLED_DISABLE_2D
   if (is2D()) {
     // compatibility with 2D
-    const uint_fast32_t cols = virtualWidth();
-    const uint_fast32_t rows = virtualHeight();
-    for (uint_fast32_t i = 0; i < rows; i++) blurRow(i, blur_amount, smear); // blur all rows
-    for (uint_fast32_t k = 0; k < cols; k++) blurCol(k, blur_amount, smear); // blur all columns
+    blur2D(blur_amount, smear); // WLEDMM blur all rows, then all columns
     return;
   }
 #endif
@@ -1441,6 +1897,9 @@ void Segment::blur(uint8_t blur_amount, bool smear) {
   uint32_t lastnew;
   uint32_t last;
   uint32_t curnew = 0;
+  // WLEDMM changed pixels are collected into runs and written with setPixelColors()
+  uint32_t run[PIXEL_SPAN_CHUNK];
+  unsigned runStart = 0, runLen = 0;
   for (unsigned i = 0; i < vlength; i++) {
     uint32_t cur = getPixelColor(i);
     uint32_t part = color_fade(cur, seep);
@@ -1449,8 +1908,17 @@ void Segment::blur(uint8_t blur_amount, bool smear) {
       if (carryover)
         curnew = color_add(curnew, carryover, !smear);  // WLEDMM
       uint32_t prev = color_add(lastnew, part, !smear); // WLEDMM
-      if (last != prev) // optimization: only set pixel if color has changed
-        setPixelColor(int(i - 1), prev);
+      if (last != prev) { // optimization: only set pixel if color has changed
+        if (runLen == 0) runStart = i - 1;
+        run[runLen++] = prev;
+      } else if (runLen > 0) { // unchanged pixel ends the run
+        setPixelColors(runStart, run, runLen);
+        runLen = 0;
+      }
+      if (runLen == PIXEL_SPAN_CHUNK) {
+        setPixelColors(runStart, run, runLen);
+        runLen = 0;
+      }
     }
     else // first pixel
       setPixelColor(int(i), curnew);
@@ -1458,6 +1926,7 @@ void Segment::blur(uint8_t blur_amount, bool smear) {
     last = cur; // save original value for comparison on next iteration
     carryover = part;
   }
+  if (runLen > 0) setPixelColors(runStart, run, runLen);
   setPixelColor(int(vlength - 1), curnew);
 }
 
@@ -1518,7 +1987,27 @@ uint32_t Segment::color_from_palette(uint_fast16_t i, bool mapping, bool wrap, u
   uint_fast16_t vLen = mapping ? virtualLength() : 1;
   if (mapping && vLen > 1) paletteIndex = (i*255)/(vLen -1);
   if (!wrap) paletteIndex = scale8(paletteIndex, 240); //cut off blend at palette "end"
-  CRGB fastled_col = ColorFromPalette(_currentPalette, paletteIndex, pbri, (strip.paletteBlend == 3)? NOBLEND:LINEARBLEND); // NOTE: paletteBlend should be global
+#ifdef WLEDMM_PALETTE_CACHE
+  if (_palCache && _palCache->valid) { // WLEDMM expanded palette
+    uint32_t color = _palCache->entries[paletteIndex];
+    if (pbri == 255) return color;
+    if (pbri == 0) return 0;
+    // same brightness scaling as FastLED ColorFromPalette()
+    uint8_t r = R(color), g = G(color), b = B(color);
+    uint8_t bri = pbri + 1;
+    #if !(FASTLED_SCALE8_FIXED==1)
+    if (r) r = scale8(r, bri) + 1;
+    if (g) g = scale8(g, bri) + 1;
+    if (b) b = scale8(b, bri) + 1;
+    #else
+    if (r) r = scale8(r, bri);
+    if (g) g = scale8(g, bri);
+    if (b) b = scale8(b, bri);
+    #endif
+    return RGBW32(r, g, b, 0);
+  }
+#endif
+  CRGB fastled_col = ColorFromPalette(getCurrentPalette(), paletteIndex, pbri, (strip.paletteBlend == 3)? NOBLEND:LINEARBLEND); // NOTE: paletteBlend should be global
 
   return RGBW32(fastled_col.r, fastled_col.g, fastled_col.b, 0);
 }
@@ -1715,6 +2204,7 @@ void WS2812FX::finalizeInit(void)
     Segment::maxWidth  = _length;
     Segment::maxHeight = 1;
   }
+  Segment::invalidatePixelMaps(); // WLEDMM busses have changed
 
   //initialize leds array. TBD: realloc if nr of leds change
   if (Segment::_globalLeds) {
@@ -1768,73 +2258,230 @@ void WS2812FX::service() {
   if (OTAisRunning) return; // WLEDMM avoid flickering during OTA
 
   now = nowUp + timebase;
+  #ifdef WLEDMM_PIPELINE_SHOW
+  // Swap: a finished frame waits in the bus back buffers until the busses have sent the previous one, then show() packs
+  // it into the driver buffers and starts sending. Rendering resumes on the next call, into the now free back buffers.
+  if (_framePending) {
+    if (busses.canAllShow()) show(); // clears _framePending
+    return;
+  }
+  // Overlap: busses with a back buffer are rendered while the previous frame is still on the wire, the others have to wait
+  if (!busses.canAllRender()) return;
+  #endif
   #if defined(ARDUINO_ARCH_ESP32) && defined(WLEDMM_FASTPATH)
     if ((_frametime > 2) && (_frametime < 32) && (nowUp - _lastShow) < (_frametime/2)) return;  // WLEDMM experimental - stabilizes frametimes but increases CPU load
     else if (nowUp - _lastShow < MIN_SHOW_DELAY) return;                                        // WLEDMM fallback
   #else
     if (nowUp - _lastShow < MIN_SHOW_DELAY) return;
   #endif
+
   bool doShow = false;
 
   _isServicing = true;
-  _segment_index = 0;
-  for (segment &seg : _segments) {
-    // reset the segment runtime data if needed
-    seg.resetIfRequired();
-
-    if (!seg.isActive()) continue;
-
-    // last condition ensures all solid segments are updated at the same time
-    if(nowUp >= seg.next_time || _triggered || (doShow && seg.mode == FX_MODE_STATIC))  // WLEDMM ">=" instead of ">"
-    {
-      if (seg.grouping == 0) seg.grouping = 1; //sanity check
-      doShow = true;
-      uint16_t frameDelay = FRAMETIME;    // WLEDMM avoid name clash with "delay" function
-
-      if (!seg.freeze) { //only run effect function if not frozen
-        _virtualSegmentLength = seg.virtualLength();
-        _colors_t[0] = seg.currentColor(0, seg.colors[0]);
-        _colors_t[1] = seg.currentColor(1, seg.colors[1]);
-        _colors_t[2] = seg.currentColor(2, seg.colors[2]);
-        seg.setCurrentPalette();              // load actual palette
-
-        if (!cctFromRgb || correctWB) busses.setSegmentCCT(seg.currentBri(seg.cct, true), correctWB);
-        for (uint8_t c = 0; c < NUM_COLORS; c++) _colors_t[c] = gamma32(_colors_t[c]);
-
-        // effect blending (execute previous effect)
-        // actual code may be a bit more involved as effects have runtime data including allocated memory
-        //if (seg.transitional && seg._modeP) (*_mode[seg._modeP])(progress());
-        frameDelay = (*_mode[seg.currentMode(seg.mode)])();
-        if (seg.mode != FX_MODE_HALLOWEEN_EYES) seg.call++;
-        if (seg.transitional && frameDelay > FRAMETIME) frameDelay = FRAMETIME; // force faster updates during transition
-
-        seg.handleTransition();
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+  if (_segments.size() > 1) { // the bus CCT is kept per render worker, so segments with different CCT can render in parallel
+    doShow = serviceParallel(nowUp);
+  } else
+#endif
+  {
+    uint8_t segIndex = 0;
+    for (segment &seg : _segments) {
+      // reset the segment runtime data if needed
+      seg.resetIfRequired();
+
+      // last condition ensures all solid segments are updated at the same time
+      if (seg.isActive() && (nowUp >= seg.next_time || _triggered || (doShow && seg.mode == FX_MODE_STATIC)))  // WLEDMM ">=" instead of ">"
+      {
+        if (seg.grouping == 0) seg.grouping = 1; //sanity check
+        doShow = true;
+        seg.next_time = nowUp + renderSegment(seg, segIndex);
       }
-
-      seg.next_time = nowUp + frameDelay;
+      segIndex++;
     }
-    _segment_index++;
   }
-  _virtualSegmentLength = 0;
+  _fxCtx[FX_WORKER_ID].virtualLength = 0;
   busses.setSegmentCCT(-1);
+  purgeIdleBuffers(); // WLEDMM
   if(doShow) {
     yield();
+    #ifdef WLEDMM_PIPELINE_SHOW
+    if (!busses.canAllShow()) _framePending = true; // previous frame still being sent - don't block, hand over later
+    else
+    #endif
     show();
   }
   _triggered = false;
   _isServicing = false;
 }
 
+// WLEDMM runs one frame of the segment's effect in the context of the calling render worker, returns the frame delay
+uint16_t WS2812FX::renderSegment(Segment &seg, uint8_t segIndex) {
+  uint16_t frameDelay = FRAMETIME;    // WLEDMM avoid name clash with "delay" function
+  if (seg.freeze) return frameDelay;  //only run effect function if not frozen
+
+  auto &ctx = _fxCtx[FX_WORKER_ID];
+  ctx.segIndex = segIndex;
+  seg.updatePixelMap();                 // WLEDMM rebuild pixel index table if geometry has changed
+  seg.updateXYList();                   // WLEDMM rebuild 1D->2D expansion if size or mapping has changed
+  ctx.virtualLength = seg.virtualLength();
+  ctx.colors[0] = seg.currentColor(0, seg.colors[0]);
+  ctx.colors[1] = seg.currentColor(1, seg.colors[1]);
+  ctx.colors[2] = seg.currentColor(2, seg.colors[2]);
+  seg.setCurrentPalette();              // load actual palette
+
+  if (!cctFromRgb || correctWB) busses.setSegmentCCT(seg.currentBri(seg.cct, true), correctWB);
+  for (uint8_t c = 0; c < NUM_COLORS; c++) ctx.colors[c] = gamma32(ctx.colors[c]);
+
+  // effect blending (execute previous effect)
+  // actual code may be a bit more involved as effects have runtime data including allocated memory
+  //if (seg.transitional && seg._modeP) (*_mode[seg._modeP])(progress());
+#ifdef WLEDMM_PROFILER
+  frametime_stats_t &prof = profSeg[segIndex < MAX_NUM_SEGMENTS ? segIndex : MAX_NUM_SEGMENTS-1];
+  if (prof.fx != seg.mode || prof.count == 0) prof.reset(seg.mode); // new effect -> new statistics
+  unsigned long t0 = micros();
+  frameDelay = (*_mode[seg.currentMode(seg.mode)])();
+  prof.add(micros() - t0);
+#else
+  frameDelay = (*_mode[seg.currentMode(seg.mode)])();
+#endif
+  if (seg.mode != FX_MODE_HALLOWEEN_EYES) seg.call++;
+  if (seg.transitional && frameDelay > FRAMETIME) frameDelay = FRAMETIME; // force faster updates during transition
+
+  seg.handleTransition();
+  return frameDelay;
+}
+
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+#ifndef WLEDMM_RENDER_WORKER_STACK
+  #define WLEDMM_RENDER_WORKER_STACK 8192
+#endif
+
+// WLEDMM second render worker: waits for a job list from serviceParallel(), renders it, and reports back
+void WS2812FX::renderWorkerTask(void *param) {
+  fxWorkerId = 1;
+  WS2812FX *fx = static_cast<WS2812FX*>(param);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    for (unsigned j = 0; j < fx->_workerJobCount; j++) {
+      uint8_t segIndex = fx->_workerJobs[j];
+      Segment &seg = fx->_segments[segIndex];
+      seg.next_time = fx->_workerNow + fx->renderSegment(seg, segIndex);
+    }
+    fx->_fxCtx[1].virtualLength = 0;
+    busses.setSegmentCCT(-1);
+    xSemaphoreGive(fx->_workerDone);
+  }
+}
+
+// WLEDMM true if both segments could write to the same LED
+static bool segmentsOverlap(const Segment &a, const Segment &b) {
+  const unsigned matrixSize = Segment::maxWidth * Segment::maxHeight;
+  const bool aMatrix = (Segment::maxHeight > 1) && (a.start < matrixSize);
+  const bool bMatrix = (Segment::maxHeight > 1) && (b.start < matrixSize);
+  if (aMatrix != bMatrix) return false;      // matrix area and 1D strips behind it are disjoint
+  if (a.start >= b.stop || b.start >= a.stop) return false;
+  if (aMatrix && (a.startY >= b.stopY || b.startY >= a.stopY)) return false;
+  return true;
+}
+
+// Segment-parallel version of the render loop in service(). Segments that do not overlap any other segment due
+// in this frame can be rendered by the second worker, until it has about half of the pixels. Everything else
+// (including the relative order of overlapping segments) stays on the calling task. Both sides are joined before show().
+bool WS2812FX::serviceParallel(unsigned long nowUp) {
+  bool doShow = false;
+  uint8_t due[MAX_NUM_SEGMENTS];
+  unsigned numDue = 0;
+  unsigned totalLoad = 0;
+
+  for (size_t i = 0; i < _segments.size(); i++) {
+    Segment &seg = _segments[i];
+    seg.resetIfRequired(); // reset the segment runtime data if needed
+    // last condition ensures all solid segments are updated at the same time
+    if (seg.isActive() && (nowUp >= seg.next_time || _triggered || (doShow && seg.mode == FX_MODE_STATIC)) && (numDue < MAX_NUM_SEGMENTS)) {
+      if (seg.grouping == 0) seg.grouping = 1; //sanity check
+      doShow = true;
+      due[numDue++] = i;
+      if (!seg.freeze) totalLoad += seg.length();
+    }
+  }
+
+  // pick jobs for the second worker
+  bool offload[MAX_NUM_SEGMENTS] = {false};
+  unsigned workerLoad = 0;
+  _workerJobCount = 0;
+  for (unsigned d = 0; d < numDue && (2 * workerLoad < totalLoad); d++) {
+    const Segment &seg = _segments[due[d]];
+    if (seg.freeze) continue;
+    bool independent = true;
+    for (unsigned e = 0; e < numDue && independent; e++)
+      if ((e != d) && segmentsOverlap(seg, _segments[due[e]])) independent = false;
+    if (!independent) continue;
+    offload[d] = true;
+    _workerJobs[_workerJobCount++] = due[d];
+    workerLoad += seg.length();
+  }
+
+  if (_workerJobCount > 0 && _workerTask == nullptr) {
+    if (_workerDone == nullptr) _workerDone = xSemaphoreCreateBinary();
+    if (_workerDone) xTaskCreatePinnedToCore(renderWorkerTask, "FXworker", WLEDMM_RENDER_WORKER_STACK, this, uxTaskPriorityGet(NULL), &_workerTask, xPortGetCoreID() ? 0 : 1);
+    if (_workerTask == nullptr) USER_PRINTLN(F("WS2812FX: failed to start render worker, rendering sequentially."));
+  }
+  if (_workerTask == nullptr) { // no worker -> everything stays here
+    _workerJobCount = 0;
+    memset(offload, 0, sizeof(offload));
+  }
+
+  if (_workerJobCount > 0) {
+    _workerNow = nowUp;
+    xTaskNotifyGive(_workerTask);
+  }
+  for (unsigned d = 0; d < numDue; d++) {
+    if (offload[d]) continue;
+    Segment &seg = _segments[due[d]];
+    seg.next_time = nowUp + renderSegment(seg, due[d]);
+  }
+  if (_workerJobCount > 0) xSemaphoreTake(_workerDone, portMAX_DELAY); // join
+  return doShow;
+}
+#endif
+
 void IRAM_ATTR WS2812FX::setPixelColor(int i, uint32_t col)
 {
-  if (i < customMappingSize) i = customMappingTable[i];
+  if (i < customMappingSize && customMappingType != MAPPING_IDENTITY) i = customMappingTable[i];
   if (i >= _length) return;
   busses.setPixelColor(i, col);
 }
 
+// WLEDMM span version of setPixelColor(); ledmapped pixels are not contiguous on the busses, so they go one by one
+void IRAM_ATTR WS2812FX::setPixelColors(int start, const uint32_t *c, unsigned n)
+{
+  if (start < 0) return;
+  if (start < customMappingSize && customMappingType != MAPPING_IDENTITY) {
+    if ((customMappingType == MAPPING_ARBITRARY) || (customMappingType == MAPPING_SERPENTINE_V) || (_mapWidth != Segment::maxWidth)) {
+      for (unsigned k = 0; k < n; k++) setPixelColor(start + int(k), c[k]);
+      return;
+    }
+    // regular layout: runs inside one matrix row that go "forward" on the LEDs can be written as a span
+    unsigned x = start % _mapWidth, y = start / _mapWidth;
+    while (n > 0 && start < customMappingSize) {
+      unsigned run = min(n, _mapWidth - x);
+      int first = mapPixelXY(x, y, start);
+      int step  = (run > 1) ? int(mapPixelXY(x+1, y, start+1)) - first : 1;
+      if ((step == 1) && (first + run <= _length)) busses.setPixelColors(first, c, run);
+      else for (unsigned k = 0; k < run; k++) setPixelColor(start + int(k), c[k]);
+      start += run; c += run; n -= run;
+      x = 0; y++;
+    }
+    if (n == 0) return;
+  }
+  if (start >= _length) return;
+  if (start + n > _length) n = _length - start;
+  busses.setPixelColors(start, c, n);
+}
+
 uint32_t WS2812FX::getPixelColor(uint_fast16_t i) // WLEDMM fast int types
 {
-  if (i < customMappingSize) i = customMappingTable[i];
+  if (i < customMappingSize && customMappingType != MAPPING_IDENTITY) i = customMappingTable[i];
   if (i >= _length) return 0;
   return busses.getPixelColor(i);
 }
@@ -1880,22 +2527,14 @@ void WS2812FX::estimateCurrentAndLimitBri() {
   }
 
   uint32_t powerSum = 0;
+#ifdef WLEDMM_BUS_BUFFER
+  busses.setBrightness(_brightness); // WLEDMM buffered busses report their power at the brightness they will be shown with
+#endif
 
   for (uint_fast8_t bNum = 0; bNum < busses.getNumBusses(); bNum++) {
     Bus *bus = busses.getBus(bNum);
     if (bus->getType() >= TYPE_NET_DDP_RGB) continue; //exclude non-physical network busses
-    uint16_t len = bus->getLength();
-    uint32_t busPowerSum = 0;
-    for (uint_fast16_t i = 0; i < len; i++) { //sum up the usage of each LED
-      uint32_t c = bus->getPixelColor(i);
-      byte r = R(c), g = G(c), b = B(c), w = W(c);
-
-      if(useWackyWS2815PowerModel) { //ignore white component on WS2815 power calculation
-        busPowerSum += (max(max(r,g),b)) * 3; // WLEDMM use native min/max
-      } else {
-        busPowerSum += (r + g + b + w);
-      }
-    }
+    uint32_t busPowerSum = bus->getPowerSum(useWackyWS2815PowerModel); // WLEDMM sum up the usage of each LED - digital busses read their raw buffer
 
     if (bus->hasWhite()) { //RGBW led total output with white LEDs enabled is still 50mA, so each channel uses less
       busPowerSum *= 3;
@@ -1932,9 +2571,18 @@ void WS2812FX::show(void) {
 
   // avoid race condition, capture _callback value
   show_callback callback = _callback;
+#ifdef WLEDMM_PROFILER
+  unsigned long t0 = micros();
+  if (callback) { callback(); profOverlay.add(micros() - t0); }
+  t0 = micros();
+  estimateCurrentAndLimitBri();
+  profAbl.add(micros() - t0);
+#else
   if (callback) callback();
 
   estimateCurrentAndLimitBri();
+#endif
+  _framePending = false; // WLEDMM any show() hands the current frame over to the busses
 
   #if defined(ARDUINO_ARCH_ESP32) && defined(WLEDMM_FASTPATH)
   unsigned long b4show = millis(); // WLEDMM the time before calling "show"
@@ -1942,7 +2590,13 @@ void WS2812FX::show(void) {
   // some buses send asynchronously and this method will return before
   // all of the data has been sent.
   // See https://github.com/Makuna/NeoPixelBus/wiki/ESP32-NeoMethods#neoesp32rmt-methods
+#ifdef WLEDMM_PROFILER
+  t0 = micros();
+  busses.show();
+  profShow.add(micros() - t0);
+#else
   busses.show();
+#endif
   unsigned long now = millis();
   unsigned long diff = now - _lastShow;
   uint16_t fpsCurr = 200;
@@ -1966,6 +2620,56 @@ void WS2812FX::show(void) {
 #endif
 }
 
+#ifdef WLEDMM_PROFILER
+// WLEDMM frame time profiler. Bin 0 holds 0..1us, then two bins per octave: [2^m, 1.5*2^m) and [1.5*2^m, 2^(m+1))
+static inline unsigned profBin(uint32_t us) {
+  if (us < 2) return 0;
+  unsigned msb = 31 - __builtin_clz(us);
+  unsigned b = 2*msb - 1 + ((us >> (msb-1)) & 1);
+  return (b < PROF_BINS) ? b : PROF_BINS-1;
+}
+static inline uint32_t profBinStart(unsigned b) {
+  if (b == 0) return 0;
+  unsigned msb = (b+1) / 2;
+  return (1U << msb) + (((b+1) & 1) ? (1U << (msb-1)) : 0);
+}
+
+void FrameTimeStats::add(uint32_t us) {
+  if (count == 0) minUs = UINT32_MAX; // also covers zero-initialized stats
+  if (count >= 32768) { // keep the histogram "recent" and avoid overflow
+    uint32_t n = 0;
+    for (unsigned b = 0; b < PROF_BINS; b++) { hist[b] = (hist[b] + 1) / 2; n += hist[b]; }
+    sum = (sum * n) / count;
+    count = n;
+  }
+  hist[profBin(us)]++;
+  count++;
+  sum += us;
+  if (us < minUs) minUs = us;
+  if (us > maxUs) maxUs = us;
+}
+
+// p-th percentile, interpolated inside the histogram bin
+uint32_t FrameTimeStats::percentile(uint8_t p) const {
+  if (count == 0) return 0;
+  uint32_t target = (uint32_t(count) * p + 99) / 100;
+  uint32_t seen = 0;
+  for (unsigned b = 0; b < PROF_BINS; b++) {
+    if (hist[b] == 0) continue;
+    if (seen + hist[b] >= target) {
+      uint32_t lo = profBinStart(b);
+      if (lo < minUs) lo = minUs;
+      uint32_t hi = (b < PROF_BINS-1) ? profBinStart(b+1) : maxUs;
+      if (hi > maxUs) hi = maxUs;
+      if (hi <= lo) return lo;
+      return lo + uint32_t((uint64_t(hi - lo) * (target - seen)) / hist[b]);
+    }
+    seen += hist[b];
+  }
+  return maxUs;
+}
+#endif
+
 /**
  * Returns a true value if any of the strips are still being updated.
  * On some hardware (ESP32), strip updates are done asynchronously.
@@ -2280,6 +2984,7 @@ void WS2812FX::fixInvalidSegments() {
   }
   // if any segments were deleted free memory
   purgeSegments();
+  Segment::invalidatePixelMaps(); // WLEDMM segment bounds may have changed
   // this is always called as the last step after finalizeInit(), update covered bus types
   for (segment &seg : _segments)
     seg.refreshLightCapabilities();
@@ -2302,12 +3007,13 @@ bool WS2812FX::checkSegmentAlignment() {
 
 //After this function is called, setPixelColor() will use that segment (offsets, grouping, ... will apply)
 //Note: If called in an interrupt (e.g. JSON API), original segment must be restored,
-//otherwise it can lead to a crash on ESP32 because _segment_index is modified while in use by the main thread
+//otherwise it can lead to a crash on ESP32 because the segment index (_fxCtx) is modified while in use by the main thread
 uint8_t WS2812FX::setPixelSegment(uint8_t n) {
-  uint8_t prevSegId = _segment_index;
+  auto &ctx = _fxCtx[FX_WORKER_ID];
+  uint8_t prevSegId = ctx.segIndex;
   if (n < _segments.size()) {
-    _segment_index = n;
-    _virtualSegmentLength = _segments[_segment_index].virtualLength();
+    ctx.segIndex = n;
+    ctx.virtualLength = _segments[n].virtualLength();
   }
   return prevSegId;
 }
@@ -2343,6 +3049,7 @@ void WS2812FX::loadCustomPalettes() {
   byte tcp[72]; //support gradient palettes with up to 18 entries
   CRGBPalette16 targetPalette;
   customPalettes.clear(); // start fresh
+  Segment::invalidatePaletteCaches(); // WLEDMM
   for (int index = 0; index<10; index++) {
     char fileName[32];
     sprintf_P(fileName, PSTR("/palette%d.json"), index);
@@ -2388,24 +3095,174 @@ void WS2812FX::loadCustomPalettes() {
   }
 }
 
+// WLEDMM classify customMappingTable after it was (re)built. Regular layouts (1:1, single panels in any orientation,
+// serpentine rows or columns) get a computed access path; only irregular maps (gaps, multiple panels) still need the table lookup.
+void WS2812FX::classifyMapping() {
+  customMappingType = MAPPING_ARBITRARY;
+  const unsigned W = Segment::maxWidth, H = Segment::maxHeight;
+  if ((customMappingTable == nullptr) || (customMappingSize == 0) || (customMappingSize != W * H)) return;
+  _mapWidth = W; _mapHeight = H;
+
+  const int base  = customMappingTable[0];
+  const int stepX = (W > 1) ? int(customMappingTable[1]) - base : 1;   // distance to right neighbour
+  const int stepY = (H > 1) ? int(customMappingTable[W]) - base : W;   // distance to lower neighbour
+  const struct { uint8_t type; int dx; int dy; } candidates[] = {
+    { MAPPING_IDENTITY,     1, int(W) },
+    { MAPPING_AFFINE,       stepX, stepY },
+    { MAPPING_SERPENTINE,   stepX, stepY - int(W - 1) * stepX },     // row 1 starts where row 0 ended
+    { MAPPING_SERPENTINE_V, stepX - int(H - 1) * stepY, stepY },     // column 1 starts where column 0 ended
+  };
+  for (const auto &cand : candidates) {
+    if ((cand.type == MAPPING_IDENTITY) && (base != 0)) continue;
+    customMappingType = cand.type; _mapBase = base; _mapDX = cand.dx; _mapDY = cand.dy;
+    bool match = true;
+    for (unsigned y = 0; match && y < H; y++) for (unsigned x = 0; x < W; x++) {
+      unsigned i = y * W + x;
+      if (mapPixelXY(x, y, i) != customMappingTable[i]) { match = false; break; }
+    }
+    if (match) break;
+    customMappingType = MAPPING_ARBITRARY;
+  }
+  USER_PRINTF("Ledmap %d x %d: type %d (base %d, dx %d, dy %d)\n", W, H, customMappingType, _mapBase, _mapDX, _mapDY);
+}
+
+// WLEDMM compiled ledmap ("/ledmapN.lmap" or "/<segment name>.lmap"), generated from the .json source on first load.
+// Layout: header, then either count raw uint16 indices, or runs of (uint16 first, int16 step, uint16 length).
+#define LEDMAP_BIN_MAGIC 0x324D4C57 // "WLM2"
+#define LEDMAP_BIN_RAW   0          // raw uint16 table
+#define LEDMAP_BIN_RUNS  1          // arithmetic runs - serpentine and panel layouts shrink to a few dozen bytes
+typedef struct LedmapBinHeader {
+  uint32_t magic;       // LEDMAP_BIN_MAGIC
+  uint32_t srcSize;     // size of the .json source at compile time, 0 = no source
+  uint32_t srcCrc;      // CRC32 of the .json source at compile time
+  uint32_t crc;         // CRC32 of the decoded table
+  uint32_t count;       // number of table entries
+  uint16_t width;       // "width" and "height" from the source, 0 = not specified, 0xFFFF = not parsed (compiled without matrix)
+  uint16_t height;
+  uint8_t  encoding;    // LEDMAP_BIN_RAW or LEDMAP_BIN_RUNS
+  uint8_t  reserved[3];
+} ledmap_bin_t;
+
+typedef struct LedmapRun {
+  uint16_t first;
+  int16_t  step;
+  uint16_t length;
+} __attribute__((packed)) ledmap_run_t;
+
+static uint32_t ledmapCRC(const uint16_t *table, size_t count) {
+  return crc32Update(0, (const uint8_t*)table, count * sizeof(uint16_t));
+}
+
+// WLEDMM read the "map":[...] array of a ledmap.json in chunks - stops at the closing bracket, negative values mean "no pixel"
+static size_t readLedmapJson(File &f, uint16_t *table, size_t maxCount) {
+  uint8_t buf[256];
+  size_t count = 0;
+  uint32_t value = 0;
+  bool inNumber = false, negative = false;
+  int len;
+  while ((len = f.read(buf, sizeof(buf))) > 0) {
+    for (int k = 0; k < len; k++) {
+      const char c = buf[k];
+      if ((c >= '0') && (c <= '9')) { value = value * 10 + (c - '0'); inNumber = true; }
+      else if (c == '-') negative = true;
+      else if ((c == ',') || (c == ']')) {
+        if (inNumber || negative) {
+          if (count < maxCount) table[count] = negative ? 0xFFFFU : uint16_t(value);  // WLEDMM do not write past array bounds
+          count++;
+        }
+        value = 0; inNumber = negative = false;
+        if (c == ']') return min(count, maxCount);
+      }
+    }
+  }
+  if (inNumber && (count < maxCount)) table[count++] = negative ? 0xFFFFU : uint16_t(value);
+  return min(count, maxCount);
+}
+
+// WLEDMM stream a compiled ledmap into table[]; returns false if damaged
+static bool readLedmapBin(File &f, const ledmap_bin_t &header, uint16_t *table, size_t maxCount) {
+  const size_t count = min(size_t(header.count), maxCount);
+  if (header.encoding == LEDMAP_BIN_RAW) {
+    if (f.read((uint8_t*)table, count * sizeof(uint16_t)) != count * sizeof(uint16_t)) return false;
+  } else if (header.encoding == LEDMAP_BIN_RUNS) {
+    ledmap_run_t runs[32];
+    size_t i = 0;
+    while (i < count) {
+      size_t got = f.read((uint8_t*)runs, sizeof(runs)) / sizeof(ledmap_run_t);
+      if (got == 0) return false;
+      for (size_t r = 0; (r < got) && (i < count); r++) {
+        uint16_t v = runs[r].first;
+        for (unsigned k = 0; (k < runs[r].length) && (i < count); k++, v += runs[r].step) table[i++] = v;
+      }
+    }
+  } else return false;
+  return (count < header.count) || (ledmapCRC(table, count) == header.crc); // truncated tables cannot be checked
+}
+
+// WLEDMM store table[] as compiled ledmap, using runs when they are smaller than the raw table
+static void writeLedmapBin(const char *binFileName, uint32_t srcSize, uint32_t srcCrc, uint16_t width, uint16_t height, const uint16_t *table, size_t count) {
+  ledmap_bin_t header;
+  memset(&header, 0, sizeof(header));
+  header.magic   = LEDMAP_BIN_MAGIC;
+  header.srcSize = srcSize;
+  header.srcCrc  = srcCrc;
+  header.crc     = ledmapCRC(table, count);
+  header.count   = count;
+  header.width   = width;
+  header.height  = height;
+
+  size_t numRuns = 0;
+  for (size_t i = 0; i < count; numRuns++) {
+    size_t len = 1;
+    int16_t step = (i+1 < count) ? int16_t(table[i+1] - table[i]) : 0;
+    while ((i + len < count) && (len < UINT16_MAX) && (int16_t(table[i+len] - table[i+len-1]) == step)) len++;
+    i += len;
+  }
+  header.encoding = (numRuns * sizeof(ledmap_run_t) < count * sizeof(uint16_t)) ? LEDMAP_BIN_RUNS : LEDMAP_BIN_RAW;
+
+  File f = WLED_FS.open(binFileName, "w");
+  if (!f) return;
+  f.write((const uint8_t*)&header, sizeof(header));
+  if (header.encoding == LEDMAP_BIN_RAW) f.write((const uint8_t*)table, count * sizeof(uint16_t));
+  else {
+    for (size_t i = 0; i < count; ) {
+      ledmap_run_t run;
+      run.first  = table[i];
+      run.step   = (i+1 < count) ? int16_t(table[i+1] - table[i]) : 0;
+      run.length = 1;
+      while ((i + run.length < count) && (run.length < UINT16_MAX) && (int16_t(table[i+run.length] - table[i+run.length-1]) == run.step)) run.length++;
+      f.write((const uint8_t*)&run, sizeof(run));
+      i += run.length;
+    }
+  }
+  f.close();
+  invalidateFileNameCache();
+  USER_PRINTF("Ledmap compiled to %s (%u entries, %s)\n", binFileName, unsigned(count), header.encoding == LEDMAP_BIN_RAW ? "raw" : "runs");
+}
+
 //load custom mapping table from JSON file (called from finalizeInit() or deserializeState())
+// WLEDMM a compiled .lmap next to the .json is used when it is up to date; otherwise the .json is parsed and compiled.
 bool WS2812FX::deserializeMap(uint8_t n) {
   // 2D support creates its own ledmap (on the fly) if a ledmap.json exists it will overwrite built one.
 
   char fileName[32] = {'\0'};
+  char binFileName[32] = {'\0'};
   //WLEDMM: als support segment name ledmaps
   bool isFile = false;;
   if (n<10) {
     strcpy_P(fileName, PSTR("/ledmap"));
     if (n) sprintf(fileName +7, "%d", n); //WLEDMM: trick to not include 0 in ledmap.json
+    strcpy(binFileName, fileName);
     strcat(fileName, ".json");
-    isFile = WLED_FS.exists(fileName);
+    strcat(binFileName, ".lmap");
+    isFile = WLED_FS.exists(fileName) || WLED_FS.exists(binFileName);
   } else { //WLEDMM add segment name as ledmap.name
     uint8_t segment_index = 0;
     for (segment &seg : _segments) {
       if (n == 10 + segment_index && !isFile && seg.name != nullptr) {
-        sprintf_P(fileName, PSTR("/%s.json"), seg.name);
-        isFile = WLED_FS.exists(fileName);
+        snprintf_P(fileName, sizeof(fileName), PSTR("/%s.json"), seg.name);
+        snprintf_P(binFileName, sizeof(binFileName), PSTR("/%s.lmap"), seg.name);
+        isFile = WLED_FS.exists(fileName) || WLED_FS.exists(binFileName);
       }
       if (isFile) break;
       segment_index++;
@@ -2418,6 +3275,7 @@ bool WS2812FX::deserializeMap(uint8_t n) {
     if (!isMatrix && !n) {
       customMappingSize = 0;
       loadedLedmap = 0; //WLEDMM
+      Segment::invalidatePixelMaps(); // WLEDMM
     }
     return false;
   }
@@ -2432,30 +3290,58 @@ bool WS2812FX::deserializeMap(uint8_t n) {
 
   //WLEDMM: change upstream code: do not load complete ledmaps in json as this blows up memory, use file read instead
   //read the file
+  const uint32_t srcSize = mapSourceSize(fileName);
+  uint32_t srcCrc = 0;
+  bool srcCrcKnown = false;
   File f;
-  f = WLED_FS.open(fileName, "r");
+
+  // WLEDMM prefer the compiled ledmap, unless its source has changed
+  ledmap_bin_t binHeader;
+  bool fromBin = false;
+  if (WLED_FS.exists(binFileName)) {
+    f = WLED_FS.open(binFileName, "r");
+    fromBin = f && (f.read((uint8_t*)&binHeader, sizeof(binHeader)) == sizeof(binHeader))
+                && (binHeader.magic == LEDMAP_BIN_MAGIC) && (!isMatrix || (binHeader.width != 0xFFFF));
+    if (fromBin && (srcSize > 0)) { // a size change needs no CRC; same size: the CRC catches the edit
+      fromBin = (binHeader.srcSize == srcSize);
+      if (fromBin) {
+        srcCrc = mapSourceCrc(fileName);
+        srcCrcKnown = true;
+        fromBin = (binHeader.srcCrc == srcCrc);
+      }
+    }
+    if (!fromBin && f) f.close();
+  }
+  if (!fromBin) f = WLED_FS.open(fileName, "r");
   if (!f) {
     releaseJSONBufferLock();
     return false; //if file does not exist just exit
   }
 
   USER_PRINT(F("Reading LED map from ")); //WLEDMM use USER_PRINT
-  USER_PRINTLN(fileName);
-
-  if (isMatrix) {
+  USER_PRINTLN(fromBin ? binFileName : fileName);
+
+  uint16_t maxWidth = 0;
+  uint16_t maxHeight = 0;
+  if (fromBin) {
+    maxWidth = binHeader.width;
+    maxHeight = binHeader.height;
+  } else if (isMatrix) {
     //WLEDMM: read width and height
-    memset(fileName, 0, sizeof(fileName));              // clear old buffer - readBytesUntil() does not terminate strings !!!
+    char dim[32] = {'\0'};                              // readBytesUntil() does not terminate strings !!!
     f.find("\"width\":");
-    f.readBytesUntil('\n', fileName, sizeof(fileName)); //hack: use fileName as we have this allocated already
-    uint16_t maxWidth = atoi(cleanUpName(fileName));
-    //DEBUG_PRINTF(" (\"width\": %s) ", fileName)
+    f.readBytesUntil('\n', dim, sizeof(dim)-1);
+    maxWidth = atoi(cleanUpName(dim));
+    //DEBUG_PRINTF(" (\"width\": %s) ", dim)
 
-    memset(fileName, 0, sizeof(fileName));              // clear old buffer
+    memset(dim, 0, sizeof(dim));                        // clear old buffer
     f.find("\"height\":");
-    f.readBytesUntil('\n', fileName, sizeof(fileName));
-    uint16_t maxHeight = atoi(cleanUpName(fileName));
-    //DEBUG_PRINTF(" (\"height\": %s) \n", fileName)
+    f.readBytesUntil('\n', dim, sizeof(dim)-1);
+    maxHeight = atoi(cleanUpName(dim));
+    //DEBUG_PRINTF(" (\"height\": %s) \n", dim)
+  }
 
+  if (isMatrix) {
     //WLEDMM: support ledmap file properties width and height: if found change segment
     if (maxWidth * maxHeight > 0) {
       Segment::maxWidth = maxWidth;
@@ -2496,17 +3382,26 @@ bool WS2812FX::deserializeMap(uint8_t n) {
     //memset(customMappingTable, 0xFF, customMappingTableSize * sizeof(uint16_t)); // FFFF = no pixel
     for (unsigned i=0; i<customMappingTableSize; i++) customMappingTable[i]=i;     // "neutral" 1:1 mapping
 
-    //WLEDMM: find the map values
-    f.find("\"map\":[");
-    uint16_t i=0;
-    do { //for each element in the array
-      int mapi = f.readStringUntil(',').toInt();
-      // USER_PRINTF(", %d(%d)", mapi, i);
-      if (i < customMappingSize) customMappingTable[i++] = (uint16_t) (mapi<0 ? 0xFFFFU : mapi);  // WLEDMM do not write past array bounds
-    } while (f.available());
+    if (fromBin && !readLedmapBin(f, binHeader, customMappingTable, customMappingSize)) {
+      USER_PRINTF("deserializeMap: %s is damaged.\n", binFileName);
+      for (unsigned i=0; i<customMappingTableSize; i++) customMappingTable[i]=i;
+      f.close();
+      fromBin = false;
+      f = WLED_FS.open(fileName, "r"); // try the source instead
+    }
+    if (!fromBin && f) {
+      //WLEDMM: find the map values
+      f.find("\"map\":[");
+      size_t count = readLedmapJson(f, customMappingTable, customMappingSize);
+      if (!srcCrcKnown) srcCrc = mapSourceCrc(fileName);
+      if (isMatrix) writeLedmapBin(binFileName, srcSize, srcCrc, maxWidth, maxHeight, customMappingTable, count); // next load will be fast
+      else          writeLedmapBin(binFileName, srcSize, srcCrc, 0xFFFF, 0xFFFF, customMappingTable, count);
+    }
 
     loadedLedmap = n;
-    f.close();
+    if (f) f.close();
+    classifyMapping();              // WLEDMM pick access path
+    Segment::invalidatePixelMaps(); // WLEDMM ledmap has changed
 
     USER_PRINTF("Custom ledmap: %d size=%d\n", loadedLedmap, customMappingSize);
     #ifdef WLED_DEBUG_MAPS
@@ -2518,6 +3413,7 @@ bool WS2812FX::deserializeMap(uint8_t n) {
     #endif
   } else { // memory allocation error
     customMappingTableSize = 0;
+    if (f) f.close();
     USER_PRINTLN(F("Deserializemap: Ledmap alloc error."));
     USER_FLUSH();
   }
@@ -17,7 +17,7 @@ uint16_t approximateKelvinFromRGB(uint32_t rgb);
 void colorRGBtoRGBW(byte* rgb);
 
 //udp.cpp
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false, uint16_t universe=1, uint16_t channel=1, uint8_t *sequence=nullptr);
 
 // enable additional debug output
 #if defined(WLED_DEBUG_HOST)
@@ -102,6 +102,28 @@ uint32_t Bus::autoWhiteCalc(uint32_t c) {
   return RGBW32(r, g, b, w);
 }
 
+// WLEDMM precompute colorBalanceFromKelvin() as 3x256 table; the float math in colorKtoRGB() runs once per CCT change
+void Bus::buildWhiteBalanceLUT(unsigned w) {
+  byte correctionRGB[4] = {0,0,0,0};
+  colorKtoRGB(_cct[w], correctionRGB);
+  for (unsigned ch = 0; ch < 3; ch++)
+    for (unsigned v = 0; v < 256; v++) _wbLUT[w][ch][v] = (uint16_t(correctionRGB[ch]) * v) / 255;
+  _wbKelvin[w] = _cct[w];
+}
+
+// WLEDMM generic ABL power sum - reads back every LED
+uint32_t Bus::getPowerSum(bool maxRGB) {
+  uint32_t sum = 0;
+  const uint16_t len = getLength();
+  for (uint_fast16_t i = 0; i < len; i++) {
+    uint32_t c = getPixelColor(i);
+    byte r = R(c), g = G(c), b = B(c), w = W(c);
+    if (maxRGB) sum += (max(max(r,g),b)) * 3; // ignore white component (WS2815 model)
+    else        sum += (r + g + b + w);
+  }
+  return sum;
+}
+
 
 BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com) : Bus(bc.type, bc.start, bc.autoWhite), _colorOrderMap(com) {
   if (!IS_DIGITAL(bc.type) || !bc.count) return;
@@ -126,6 +148,11 @@ BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com) : Bu
   _busPtr = PolyBus::create(_iType, _pins, lenToCreate, nr, _frequencykHz);
   _valid = (_busPtr != nullptr);
   _colorOrder = bc.colorOrder;
+  compileColorOrder();
+#ifdef WLEDMM_BUS_BUFFER
+  if (_valid) _data = (uint32_t*) calloc(bc.count, sizeof(uint32_t)); // on failure, we fall back to writing the driver buffer directly
+  if (_valid && !_data) USER_PRINTLN(F("BusDigital: no memory for pixel buffer, using direct output."));
+#endif
   if (_pins[1] != 255) {  // WLEDMM USER_PRINTF
     USER_PRINTF("%successfully inited strip %u (len %u) with type %u and pins %u,%u (itype %u)\n", _valid?"S":"Uns", nr, _len, bc.type, _pins[0],_pins[1],_iType);
   } else {
@@ -133,10 +160,46 @@ BusDigital::BusDigital(BusConfig &bc, uint8_t nr, const ColorOrderMap &com) : Bu
   }
 }
 
+// WLEDMM with _data, this is the buffer swap: call it only when canShow(), the driver buffer must not change while it is being sent
 void BusDigital::show() {
+#ifdef WLEDMM_BUS_BUFFER
+  if (_data) packBuffer();
+#endif
   PolyBus::show(_busPtr, _iType);
 }
 
+#ifdef WLEDMM_BUS_BUFFER
+// WLEDMM output pass: color order, reverse/skip and brightness (NPB luminance) are applied once per LED and frame
+void IRAM_ATTR_YN BusDigital::packBuffer() {
+  const uint16_t len = getLength();
+  unsigned r = 0;
+  uint8_t co = _coRuns[0].colorOrder;
+  const bool singleOrder = (_coRunCount == 1);
+
+  if (_type == TYPE_WS2812_1CH_X3) { // each IC controls 3 LEDs, one channel per LED
+    const uint16_t numICs = NUM_ICS_WS2812_1CH_3X(_len);
+    for (unsigned ic = 0; ic < numICs; ic++) {
+      uint8_t ch[3] = {0, 0, 0};
+      for (unsigned k = 0; k < 3; k++) {
+        unsigned p = ic*3 + k;  // physical LED
+        if (p < _skip || p >= _len) continue;
+        uint32_t c = _data[reversed ? (_len - p - 1) : (p - _skip)];
+        ch[k] = W(c);
+      }
+      if (!singleOrder) co = colorOrderAt(ic*3, r);
+      PolyBus::setPixelColor(_busPtr, _iType, ic, RGBW32(ch[1], ch[0], ch[2], 0), co);
+    }
+    return;
+  }
+
+  for (unsigned i = 0; i < len; i++) {
+    uint16_t p = reversed ? (_len - i - 1) : (i + _skip);
+    if (!singleOrder) co = colorOrderAt(p, r);
+    PolyBus::setPixelColor(_busPtr, _iType, p, _data[i], co);
+  }
+}
+#endif
+
 bool BusDigital::canShow() {
   return PolyBus::canShow(_busPtr, _iType);
 }
@@ -149,6 +212,9 @@ void BusDigital::setBrightness(uint8_t b, bool immediate) {
   }
   #endif
   Bus::setBrightness(b, immediate);
+#ifdef WLEDMM_BUS_BUFFER
+  if (_data) immediate = false; // show() re-packs the whole frame with the new brightness anyway
+#endif
   PolyBus::setBrightness(_busPtr, _iType, b, immediate);
 }
 
@@ -156,17 +222,25 @@ void BusDigital::setBrightness(uint8_t b, bool immediate) {
 //TODO only show if no new show due in the next 50ms
 void BusDigital::setStatusPixel(uint32_t c) {
   if (_skip && canShow()) {
-    PolyBus::setPixelColor(_busPtr, _iType, 0, c, _colorOrderMap.getPixelColorOrder(_start, _colorOrder));
+    PolyBus::setPixelColor(_busPtr, _iType, 0, c, _coRuns[0].colorOrder);
     PolyBus::show(_busPtr, _iType);
   }
 }
 
 void IRAM_ATTR BusDigital::setPixelColor(uint16_t pix, uint32_t c) {
+#ifdef WLEDMM_BUS_BUFFER
+  if (_data) {
+    if (pix >= getLength()) return; // _data has no room for skipped LEDs; NeoPixelBus did this check on the direct path
+    _data[pix] = bufferColor(c);
+    return;
+  }
+#endif
   if (_type == TYPE_SK6812_RGBW || _type == TYPE_TM1814 || _type == TYPE_WS2812_1CH_X3) c = autoWhiteCalc(c);
-  if (_cct >= 1900) c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+  if (workerCCT() >= 1900) c = whiteBalance(c); //color correction from CCT
   if (reversed) pix = _len - pix -1;
   else pix += _skip;
-  uint8_t co = _colorOrderMap.getPixelColorOrder(pix+_start, _colorOrder);
+  unsigned r = 0;
+  uint8_t co = colorOrderAt(pix, r);
   if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs
     uint16_t pOld = pix;
     pix = IC_INDEX_WS2812_1CH_3X(pix);
@@ -180,10 +254,44 @@ void IRAM_ATTR BusDigital::setPixelColor(uint16_t pix, uint32_t c) {
   PolyBus::setPixelColor(_busPtr, _iType, pix, c, co);
 }
 
+// WLEDMM span version of setPixelColor() - per-pixel decisions are taken once for the whole span
+void IRAM_ATTR_YN BusDigital::setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n) {
+#ifdef WLEDMM_BUS_BUFFER
+  if (_data) {
+    if (pix >= getLength()) return;
+    if (n > getLength() - pix) n = getLength() - pix;
+    const bool doAutoWhite = (_type == TYPE_SK6812_RGBW || _type == TYPE_TM1814 || _type == TYPE_WS2812_1CH_X3);
+    if (doAutoWhite || (workerCCT() >= 1900)) for (unsigned i = 0; i < n; i++) _data[pix + i] = bufferColor(c[i]);
+    else memcpy(_data + pix, c, n * sizeof(uint32_t));
+    return;
+  }
+#endif
+  if (_type == TYPE_WS2812_1CH_X3) { Bus::setPixelSpan(pix, c, n); return; } // needs read-modify-write per IC
+  const bool doAutoWhite = (_type == TYPE_SK6812_RGBW || _type == TYPE_TM1814);
+  const bool doCCT = (workerCCT() >= 1900);
+  const bool singleOrder = (_coRunCount == 1);
+  unsigned r = 0;
+  uint8_t co = _coRuns[0].colorOrder;
+  for (unsigned i = 0; i < n; i++) {
+    uint32_t col = c[i];
+    if (doAutoWhite) col = autoWhiteCalc(col);
+    if (doCCT) col = whiteBalance(col); //color correction from CCT
+    uint16_t p = pix + i;
+    if (reversed) p = _len - p -1;
+    else p += _skip;
+    if (!singleOrder) co = colorOrderAt(p, r);
+    PolyBus::setPixelColor(_busPtr, _iType, p, col, co);
+  }
+}
+
 uint32_t IRAM_ATTR_YN BusDigital::getPixelColor(uint16_t pix) {
+#ifdef WLEDMM_BUS_BUFFER
+  if (_data) return (pix < getLength()) ? _data[pix] : 0; // not scaled by brightness
+#endif
   if (reversed) pix = _len - pix -1;
   else pix += _skip;
-  uint8_t co = _colorOrderMap.getPixelColorOrder(pix+_start, _colorOrder);
+  unsigned r = 0;
+  uint8_t co = colorOrderAt(pix, r);
   if (_type == TYPE_WS2812_1CH_X3) { // map to correct IC, each controls 3 LEDs
     uint16_t pOld = pix;
     pix = IC_INDEX_WS2812_1CH_3X(pix);
@@ -198,6 +306,41 @@ uint32_t IRAM_ATTR_YN BusDigital::getPixelColor(uint16_t pix) {
   return PolyBus::getPixelColor(_busPtr, _iType, pix, co);
 }
 
+// WLEDMM ABL power sum straight from the NPB buffer, instead of one getPixelColor() per LED.
+// r+g+b+w does not depend on the channel order, and for 3-channel LEDs neither does max(r,g,b), so the raw bytes give the same result.
+uint32_t BusDigital::getPowerSum(bool maxRGB) {
+#ifdef WLEDMM_BUS_BUFFER
+  if (_data) { // buffer holds full-brightness colors -> apply brightness here, like show() will do
+    const uint16_t len = getLength();
+    uint32_t sum = 0;
+    for (unsigned i = 0; i < len; i++) {
+      uint32_t c = _data[i];
+      if (_type == TYPE_WS2812_1CH_X3) { sum += W(c) * (maxRGB ? 3 : 4); continue; } // same as getPixelColor() without buffer
+      byte r = R(c), g = G(c), b = B(c), w = W(c);
+      if (maxRGB) sum += (max(max(r,g),b)) * 3; // ignore white component (WS2815 model)
+      else        sum += (r + g + b + w);
+    }
+    return (uint64_t(sum) * _bri) / 255;
+  }
+#endif
+  uint8_t pixelSize = 0;
+  const uint8_t* p = (_valid && _busPtr && (_type != TYPE_WS2812_1CH_X3)) ? PolyBus::getPixels(_busPtr, _iType, pixelSize) : nullptr;
+  if ((p == nullptr) || (pixelSize < 3) || (maxRGB && (pixelSize != 3))) return Bus::getPowerSum(maxRGB); // 16bit, SPI and 1CH_X3 types, RGBW with WS2815 model
+
+  p += _skip * pixelSize; // skipped LEDs are not part of getPixelColor()
+  const uint8_t* const end = p + size_t(_len - _skip) * pixelSize;
+  uint32_t sum = 0;
+  if (maxRGB) {
+    for (; p < end; p += 3) sum += max(max(p[0], p[1]), p[2]);
+    return sum * 3;
+  }
+  uint32_t sum2 = 0; // two accumulators, 4 bytes per step
+  const uint8_t* const end4 = p + ((end - p) & ~size_t(3));
+  for (; p < end4; p += 4) { sum += p[0] + p[1]; sum2 += p[2] + p[3]; }
+  for (; p < end; p++) sum += *p;
+  return sum + sum2;
+}
+
 uint8_t BusDigital::getPins(uint8_t* pinArray) {
   uint8_t numPins = IS_2PIN(_type) ? 2 : 1;
   for (uint8_t i = 0; i < numPins; i++) pinArray[i] = _pins[i];
@@ -208,10 +351,44 @@ void BusDigital::setColorOrder(uint8_t colorOrder) {
   // upper nibble contains W swap information
   if ((colorOrder & 0x0F) > 5) return;
   _colorOrder = colorOrder;
+  compileColorOrder();
+}
+
+// WLEDMM turn the global color order map into a sorted run list for the LEDs of this bus (first matching mapping wins, like ColorOrderMap::getPixelColorOrder())
+void BusDigital::compileColorOrder() {
+  uint16_t cuts[2*WLED_MAX_COLOR_ORDER_MAPPINGS+2];
+  unsigned n = 0;
+  cuts[n++] = 0;
+  for (unsigned i = 0; i < _colorOrderMap.count(); i++) {
+    const ColorOrderMapEntry *e = _colorOrderMap.get(i);
+    int from = int(e->start) - _start;
+    int to   = from + e->len;
+    if (from > 0 && from < _len) cuts[n++] = from;
+    if (to   > 0 && to   < _len) cuts[n++] = to;
+  }
+  cuts[n++] = _len;
+  for (unsigned i = 1; i < n; i++) // insertion sort, n is tiny
+    for (unsigned j = i; j > 0 && cuts[j-1] > cuts[j]; j--) std::swap(cuts[j-1], cuts[j]);
+
+  // build into a local table, so _coRuns/_coRunCount are never seen half-built or empty
+  ColorOrderRun runs[WLED_MAX_COLOR_ORDER_RUNS];
+  unsigned count = 0;
+  for (unsigned k = 0; k+1 < n; k++) {
+    if (cuts[k] == cuts[k+1]) continue;
+    uint8_t co = _colorOrderMap.getPixelColorOrder(cuts[k] + _start, _colorOrder);
+    if ((count > 0) && (runs[count-1].colorOrder == co)) runs[count-1].end = cuts[k+1];
+    else if (count < WLED_MAX_COLOR_ORDER_RUNS) runs[count++] = {cuts[k+1], co};
+  }
+  if (count == 0) runs[count++] = {UINT16_MAX, _colorOrder}; // empty bus
+  runs[count-1].end = UINT16_MAX; // last run catches everything
+  if (count < _coRunCount) _coRunCount = count; // shrink first, then fill, then grow: the count never covers stale entries
+  memcpy(_coRuns, runs, count * sizeof(ColorOrderRun));
+  _coRunCount = count;
 }
 
 void BusDigital::reinit() {
   PolyBus::begin(_busPtr, _iType, _pins);
+  compileColorOrder();
 }
 
 void BusDigital::cleanup() {
@@ -220,6 +397,10 @@ void BusDigital::cleanup() {
   _iType = I_NONE;
   _valid = false;
   _busPtr = nullptr;
+#ifdef WLEDMM_BUS_BUFFER
+  free(_data);
+  _data = nullptr;
+#endif
   pinManager.deallocatePin(_pins[1], PinOwner::BusDigital);
   pinManager.deallocatePin(_pins[0], PinOwner::BusDigital);
 }
@@ -234,7 +415,7 @@ BusPwm::BusPwm(BusConfig &bc) : Bus(bc.type, bc.start, bc.autoWhite) {
   #ifdef ESP8266
   analogWriteRange(255);  //same range as one RGB channel
   analogWriteFreq(_frequency);
-  #else
+  #elif defined(ARDUINO_ARCH_ESP32)
   _ledcStart = pinManager.allocateLedc(numPins);
   if (_ledcStart == 255) { //no more free LEDC channels
     deallocatePins(); return;
@@ -249,7 +430,7 @@ BusPwm::BusPwm(BusConfig &bc) : Bus(bc.type, bc.start, bc.autoWhite) {
     _pins[i] = currentPin; //store only after allocatePin() succeeds
     #ifdef ESP8266
     pinMode(_pins[i], OUTPUT);
-    #else
+    #elif defined(ARDUINO_ARCH_ESP32)
     ledcSetup(_ledcStart + i, _frequency, 8);
     ledcAttachPin(_pins[i], _ledcStart + i);
     #endif
@@ -261,17 +442,18 @@ BusPwm::BusPwm(BusConfig &bc) : Bus(bc.type, bc.start, bc.autoWhite) {
 void BusPwm::setPixelColor(uint16_t pix, uint32_t c) {
   if (pix != 0 || !_valid) return; //only react to first pixel
   if (_type != TYPE_ANALOG_3CH) c = autoWhiteCalc(c);
-  if (_cct >= 1900 && (_type == TYPE_ANALOG_3CH || _type == TYPE_ANALOG_4CH)) {
-    c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+  const int16_t segCCT = workerCCT();
+  if (segCCT >= 1900 && (_type == TYPE_ANALOG_3CH || _type == TYPE_ANALOG_4CH)) {
+    c = whiteBalance(c); //color correction from CCT
   }
   uint8_t r = R(c);
   uint8_t g = G(c);
   uint8_t b = B(c);
   uint8_t w = W(c);
   uint8_t cct = 0; //0 - full warm white, 255 - full cold white
-  if (_cct > -1) {
-    if (_cct >= 1900)    cct = (_cct - 1900) >> 5;
-    else if (_cct < 256) cct = _cct;
+  if (segCCT > -1) {
+    if (segCCT >= 1900)    cct = (segCCT - 1900) >> 5;
+    else if (segCCT < 256) cct = segCCT;
   } else {
     cct = (approximateKelvinFromRGB(c) - 1900) >> 5;
   }
@@ -345,7 +527,7 @@ void BusPwm::show() {
     if (reversed) scaled = 255 - scaled;
     #ifdef ESP8266
     analogWrite(_pins[i], scaled);
-    #else
+    #elif defined(ARDUINO_ARCH_ESP32)
     ledcWrite(_ledcStart + i, scaled);
     #endif
   }
@@ -367,7 +549,7 @@ void BusPwm::deallocatePins() {
     if (!pinManager.isPinOk(_pins[i])) continue;
     #ifdef ESP8266
     digitalWrite(_pins[i], LOW); //turn off PWM interrupt
-    #else
+    #elif defined(ARDUINO_ARCH_ESP32)
     if (_ledcStart < 16) ledcDetachPin(_pins[i]);
     #endif
   }
@@ -441,6 +623,8 @@ BusNetwork::BusNetwork(BusConfig &bc) : Bus(bc.type, bc.start, bc.autoWhite) {
   memset(_data, 0, bc.count * _UDPchannels);
   _len = bc.count;
   _client = IPAddress(bc.pins[0],bc.pins[1],bc.pins[2],bc.pins[3]);
+  _universe = bc.universe;
+  _channel = bc.channel;
   _broadcastLock = false;
   _valid = true;
 }
@@ -448,7 +632,7 @@ BusNetwork::BusNetwork(BusConfig &bc) : Bus(bc.type, bc.start, bc.autoWhite) {
 void BusNetwork::setPixelColor(uint16_t pix, uint32_t c) {
   if (!_valid || pix >= _len) return;
   if (hasWhite()) c = autoWhiteCalc(c);
-  if (_cct >= 1900) c = colorBalanceFromKelvin(_cct, c); //color correction from CCT
+  if (workerCCT() >= 1900) c = whiteBalance(c); //color correction from CCT
   uint16_t offset = pix * _UDPchannels;
   _data[offset]   = R(c);
   _data[offset+1] = G(c);
@@ -456,6 +640,25 @@ void BusNetwork::setPixelColor(uint16_t pix, uint32_t c) {
   if (_rgbw) _data[offset+3] = W(c);
 }
 
+// WLEDMM span version of setPixelColor() - writes directly into the UDP buffer
+void BusNetwork::setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n) {
+  if (!_valid || pix >= _len) return;
+  if (pix + n > _len) n = _len - pix;
+  const bool doAutoWhite = hasWhite();
+  const bool doCCT = (workerCCT() >= 1900);
+  byte *dest = _data + pix * _UDPchannels;
+  for (unsigned i = 0; i < n; i++) {
+    uint32_t col = c[i];
+    if (doAutoWhite) col = autoWhiteCalc(col);
+    if (doCCT) col = whiteBalance(col); //color correction from CCT
+    dest[0] = R(col);
+    dest[1] = G(col);
+    dest[2] = B(col);
+    if (_rgbw) dest[3] = W(col);
+    dest += _UDPchannels;
+  }
+}
+
 uint32_t BusNetwork::getPixelColor(uint16_t pix) {
   if (!_valid || pix >= _len) return 0;
   uint16_t offset = pix * _UDPchannels;
@@ -465,7 +668,7 @@ uint32_t BusNetwork::getPixelColor(uint16_t pix) {
 void BusNetwork::show() {
   if (!_valid || !canShow()) return;
   _broadcastLock = true;
-  realtimeBroadcast(_UDPtype, _client, _len, _data, _bri, _rgbw);
+  realtimeBroadcast(_UDPtype, _client, _len, _data, _bri, _rgbw, _universe, _channel, _sequence);
   _broadcastLock = false;
 }
 
@@ -684,6 +887,19 @@ void BusHub75Matrix::setPixelColor(uint16_t pix, uint32_t c) {
   }
 }
 
+// WLEDMM span version of setPixelColor() - walks x/y instead of dividing for each pixel
+void BusHub75Matrix::setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n) {
+  const uint16_t width = (fourScanPanel != nullptr) ? fourScanPanel->width() : display->width();
+  if (width == 0) return;
+  uint16_t px = pix % width;
+  uint16_t py = pix / width;
+  for (unsigned i = 0; i < n; i++) {
+    if (fourScanPanel != nullptr) fourScanPanel->drawPixelRGB888(px, py, R(c[i]), G(c[i]), B(c[i]));
+    else                          display->drawPixelRGB888(px, py, R(c[i]), G(c[i]), B(c[i]));
+    if (++px >= width) { px = 0; py++; }
+  }
+}
+
 void BusHub75Matrix::setBrightness(uint8_t b, bool immediate) {
   this->display->setBrightness(b);
 }
@@ -750,11 +966,46 @@ int BusManager::add(BusConfig &bc) {
   } else {
     busses[numBusses] = new BusPwm(bc);
   }
-  // WLEDMM clear cached Bus info
-  lastBus = nullptr;
-  laststart = 0;
-  lastend = 0;
-  return numBusses++;
+  numBusses++;
+  buildRoutes(); // WLEDMM
+  return numBusses - 1;
+}
+
+// WLEDMM insert [start, end) -> b into the sorted routing table
+void BusManager::addRoute(unsigned start, unsigned end, Bus *b) {
+  if (numRoutes >= WLED_MAX_BUS_ROUTES) return; // cannot happen, see WLED_MAX_BUS_ROUTES
+  unsigned j = numRoutes++;
+  for (; j > 0 && routeStart[j-1] > start; j--) { // insertion sort
+    routeStart[j] = routeStart[j-1]; routeEnd[j] = routeEnd[j-1]; routeBus[j] = routeBus[j-1];
+  }
+  routeStart[j] = start;
+  routeEnd[j]   = end;
+  routeBus[j]   = b;
+}
+
+// WLEDMM sort bus ranges by start, so findBus() does not need to scan all busses.
+// Each bus only gets the LEDs that no earlier bus has claimed, so overlapping or nested busses keep working.
+void BusManager::buildRoutes() {
+  numRoutes = 0;
+  for (unsigned i = 0; i < numBusses; i++) {
+    Bus *b = busses[i];
+    if (b == nullptr || b->getLength() == 0) continue;
+    const unsigned start = b->getStart();
+    const unsigned end = min(start + b->getLength(), 0xFFFFU);
+    // collect the gaps in [start, end) that are not covered by the (sorted, disjoint) routes so far
+    uint16_t gapStart[WLED_MAX_BUS_ROUTES], gapEnd[WLED_MAX_BUS_ROUTES];
+    unsigned gaps = 0, cur = start;
+    for (unsigned k = 0; k < numRoutes && cur < end; k++) {
+      if (routeEnd[k] <= cur) continue;
+      if (routeStart[k] >= end) break;
+      if (routeStart[k] > cur) { gapStart[gaps] = cur; gapEnd[gaps] = routeStart[k]; gaps++; }
+      cur = max(cur, unsigned(routeEnd[k]));
+    }
+    if (cur < end) { gapStart[gaps] = cur; gapEnd[gaps] = end; gaps++; }
+    if ((gaps != 1) || (gapStart[0] != start) || (gapEnd[0] != end))
+      DEBUG_PRINTF("Bus %u (%u-%u) overlaps an earlier bus, which keeps the shared LEDs.\n", i, start, end-1);
+    for (unsigned g = 0; g < gaps; g++) addRoute(gapStart[g], gapEnd[g], b);
+  }
 }
 
 //do not call this method from system context (network callback)
@@ -764,16 +1015,34 @@ void BusManager::removeAll() {
   while (!canAllShow()) yield();
   for (uint8_t i = 0; i < numBusses; i++) delete busses[i];
   numBusses = 0;
-  // WLEDMM clear cached Bus info
-  lastBus = nullptr;
-  laststart = 0;
-  lastend = 0;
+  buildRoutes(); // WLEDMM
 }
 
 void BusManager::show() {
+  bool anySent = false;
+  const unsigned long now = millis();
+  // WLEDMM apply a new color order map here, in the loop task, and not in the web task that received it
+  const bool coChanged = colorOrderMapChanged;
+  if (coChanged) {
+    colorOrderMapChanged = false;
+    for (uint8_t i = 0; i < numBusses; i++) busses[i]->compileColorOrder();
+  }
   for (uint8_t i = 0; i < numBusses; i++) {
-    busses[i]->show();
+    #ifndef WLEDMM_NO_SHOW_SKIP
+    // WLEDMM only transmit busses with new content or brightness (or those that always need a refresh)
+    bool sendIt = coChanged || busses[i]->frameChanged() || busses[i]->isOffRefreshRequired();
+    // network receivers drop a source that stays silent (E1.31 after 2.5s), so static scenes are repeated periodically
+    if (busses[i]->isVirtual() && (now - busses[i]->lastShown() >= WLEDMM_BUS_KEEPALIVE)) sendIt = true;
+    #else
+    bool sendIt = true;
+    #endif
+    if (sendIt) busses[i]->show();
+    busses[i]->frameDone(sendIt, now);
+    anySent |= sendIt;
   }
+  e131OutSync(); // WLEDMM one E1.31 sync packet per frame, after all network busses have sent
+  if (anySent) framesSent++;
+  else framesSkipped++;
 }
 
 void BusManager::setStatusPixel(uint32_t c) {
@@ -783,24 +1052,25 @@ void BusManager::setStatusPixel(uint32_t c) {
 }
 
 void IRAM_ATTR BusManager::setPixelColor(uint16_t pix, uint32_t c, int16_t cct) {
-  if ((pix >= laststart) && (pix < lastend ) && (lastBus != nullptr)) {
-    // WLEDMM same bus as last time - no need to search again
-    lastBus->setPixelColor(pix - laststart, c);
-    return;
-  }
+  uint_fast16_t bstart = 0;
+  Bus* b = findBus(pix, bstart); // WLEDMM routing table lookup, independent of the previous pixel's bus
+  if (b == nullptr) return;
+  b->hashPixel(pix - bstart, c);
+  b->setPixelColor(pix - bstart, c);
+}
 
-  for (uint_fast8_t i = 0; i < numBusses; i++) {    // WLEDMM use fast native types
-    Bus* b = busses[i];
-    uint_fast16_t bstart = b->getStart();
-    if (pix < bstart || pix >= bstart + b->getLength()) continue;
-    else {
-      // WLEDMM remember last Bus we took
-      lastBus = b;
-      laststart = bstart; 
-      lastend = bstart + b->getLength();
-      b->setPixelColor(pix - bstart, c);
-      break; // WLEDMM found the right Bus -> so we can stop searching
-    }
+// WLEDMM write n consecutive pixels; the span is split at route boundaries, so each bus gets one call per route
+void IRAM_ATTR BusManager::setPixelColors(uint16_t start, const uint32_t *c, uint16_t n) {
+  const unsigned end = start + n;
+  for (uint_fast8_t i = 0; i < numRoutes; i++) {
+    if (routeStart[i] >= end) break; // sorted
+    if (routeEnd[i] <= start) continue;
+    Bus* b = routeBus[i];
+    unsigned bstart = b->getStart();
+    unsigned from = max(unsigned(start), unsigned(routeStart[i]));
+    unsigned to   = min(end, unsigned(routeEnd[i]));
+    for (unsigned p = from; p < to; p++) b->hashPixel(p - bstart, c[p - start]);
+    b->setPixelSpan(from - bstart, c + (from - start), to - from);
   }
 }
 
@@ -820,24 +1090,9 @@ void BusManager::setSegmentCCT(int16_t cct, bool allowWBCorrection) {
 }
 
 uint32_t IRAM_ATTR BusManager::getPixelColor(uint_fast16_t pix) {     // WLEDMM use fast native types, IRAM_ATTR
-  if ((pix >= laststart) && (pix < lastend ) && (lastBus != nullptr)) {
-    // WLEDMM same bus as last time - no need to search again
-    return lastBus->getPixelColor(pix - laststart);
-  }
-
-  for (uint_fast8_t i = 0; i < numBusses; i++) {
-    Bus* b = busses[i];
-    uint_fast16_t bstart = b->getStart();
-    if (pix < bstart || pix >= bstart + b->getLength()) continue;
-    else {
-      // WLEDMM remember last Bus we took
-      lastBus = b;
-      laststart = bstart; 
-      lastend = bstart + b->getLength();
-      return b->getPixelColor(pix - bstart);
-    }
-  }
-  return 0;
+  uint_fast16_t bstart = 0;
+  Bus* b = findBus(pix, bstart);
+  return b ? b->getPixelColor(pix - bstart) : 0;
 }
 
 bool BusManager::canAllShow() {
@@ -847,6 +1102,13 @@ bool BusManager::canAllShow() {
   return true;
 }
 
+bool BusManager::canAllRender() {
+  for (uint8_t i = 0; i < numBusses; i++) {
+    if (!busses[i]->canRender()) return false;
+  }
+  return true;
+}
+
 Bus* BusManager::getBus(uint8_t busNr) {
   if (busNr >= numBusses) return nullptr;
   return busses[busNr];
@@ -860,6 +1122,13 @@ uint16_t BusManager::getTotalLength() {
 }
 
 // Bus static member definition
-int16_t Bus::_cct = -1;
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+int16_t Bus::_cct[WLED_RENDER_WORKERS] = {-1, -1};
+int16_t Bus::_wbKelvin[WLED_RENDER_WORKERS] = {-1, -1};
+#else
+int16_t Bus::_cct[WLED_RENDER_WORKERS] = {-1};
+int16_t Bus::_wbKelvin[WLED_RENDER_WORKERS] = {-1};
+#endif
 uint8_t Bus::_cctBlend = 0;
+uint8_t Bus::_wbLUT[WLED_RENDER_WORKERS][3][256];
 uint8_t Bus::_gAWM = 255;
@@ -15,6 +15,16 @@
 #define SET_BIT(var,bit)    ((var)|=(uint16_t)(0x0001<<(bit)))
 #define UNSET_BIT(var,bit)  ((var)&=(~(uint16_t)(0x0001<<(bit))))
 
+// WLEDMM digital busses keep RGBW in their own buffer while rendering; auto-white and white balance LUT are applied on write
+// (in that order, like the direct path), color order and brightness once per frame in show(). ESP32 only, costs 4 bytes per LED.
+#if !defined(ESP8266) && !defined(WLEDMM_NO_BUS_BUFFER)
+  #define WLEDMM_BUS_BUFFER
+#endif
+// WLEDMM pipelined show (see FX.h) renders the next frame into this buffer while the driver sends the previous one - no buffer, no overlap
+#if defined(WLEDMM_PIPELINE_SHOW) && (defined(ARDUINO_ARCH_ESP32) || defined(WLED_NATIVE)) && !defined(WLEDMM_BUS_BUFFER)
+  #error "WLEDMM_PIPELINE_SHOW needs the bus buffer - remove -D WLEDMM_NO_BUS_BUFFER"
+#endif
+
 #define NUM_ICS_WS2812_1CH_3X(len) (((len)+2)/3)   // 1 WS2811 IC controls 3 zones (each zone has 1 LED, W)
 #define IC_INDEX_WS2812_1CH_3X(i)  ((i)/3)
 
@@ -34,10 +44,13 @@ struct BusConfig {
   uint8_t autoWhite;
   uint8_t pins[5] = {LEDPIN, 255, 255, 255, 255};
   uint16_t frequency;
-  BusConfig(uint8_t busType, uint8_t* ppins, uint16_t pstart, uint16_t len = 1, uint8_t pcolorOrder = COL_ORDER_GRB, bool rev = false, uint8_t skip = 0, byte aw=RGBW_MODE_MANUAL_ONLY, uint16_t clock_kHz=0U) {
+  uint16_t universe;    // WLEDMM E1.31 network bus: first universe (1..63999)
+  uint16_t channel;     // WLEDMM E1.31 network bus: first DMX channel (1..512) in the first universe
+  BusConfig(uint8_t busType, uint8_t* ppins, uint16_t pstart, uint16_t len = 1, uint8_t pcolorOrder = COL_ORDER_GRB, bool rev = false, uint8_t skip = 0, byte aw=RGBW_MODE_MANUAL_ONLY, uint16_t clock_kHz=0U, uint16_t univ=1, uint16_t chan=1) {
     refreshReq = (bool) GET_BIT(busType,7);
     type = busType & 0x7F;  // bit 7 may be/is hacked to include refresh info (1=refresh in off state, 0=no refresh)
     count = len; start = pstart; colorOrder = pcolorOrder; reversed = rev; skipAmount = skip; autoWhite = aw; frequency = clock_kHz;
+    universe = constrain(univ, 1, 63999); channel = constrain(chan, 1, 512); // WLEDMM
     uint8_t nPins = 1;
     if (type >= TYPE_NET_DDP_RGB && type < 96) nPins = 4; //virtual network bus. 4 "pins" store IP address
     else if (type > 47) nPins = 2;
@@ -59,6 +72,11 @@ struct BusConfig {
   }
 };
 
+// WLEDMM network busses repeat an unchanged frame after this many ms (E1.31 receivers time out after 2.5s)
+#ifndef WLEDMM_BUS_KEEPALIVE
+#define WLEDMM_BUS_KEEPALIVE 1000
+#endif
+
 // Defines an LED Strip and its color ordering.
 struct ColorOrderMapEntry {
   uint16_t start;
@@ -66,6 +84,13 @@ struct ColorOrderMapEntry {
   uint8_t colorOrder;
 };
 
+// WLEDMM run of LEDs with the same color order, relative to the start of a bus; see BusDigital::compileColorOrder()
+struct ColorOrderRun {
+  uint16_t end;       // first LED after the run
+  uint8_t colorOrder;
+};
+#define WLED_MAX_COLOR_ORDER_RUNS (2*WLED_MAX_COLOR_ORDER_MAPPINGS+1)
+
 struct ColorOrderMap {
     void add(uint16_t start, uint16_t len, uint8_t colorOrder);
 
@@ -104,28 +129,55 @@ class Bus {
       _type = type;
       _start = start;
       _autoWhiteMode = Bus::hasWhite(type) ? aw : RGBW_MODE_MANUAL_ONLY;
+      for (unsigned w = 0; w < WLED_RENDER_WORKERS; w++) { _frameHash[w] = 2166136261U; _shownHash[w] = 0; _frameWrites[w] = false; } // WLEDMM FNV offset basis for every worker
     };
 
     virtual ~Bus() {} //throw the bus under the bus
 
     virtual void     show() = 0;
     virtual bool     canShow() { return true; }
+    virtual bool     canRender() { return true; }   // WLEDMM effects may write pixels now without touching a frame that is still being sent
     virtual void     setStatusPixel(uint32_t c) {}
     virtual void     setPixelColor(uint16_t pix, uint32_t c) = 0;
+    virtual void     setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n) { for (unsigned i = 0; i < n; i++) setPixelColor(pix + i, c[i]); } // WLEDMM write n consecutive pixels
     virtual uint32_t getPixelColor(uint16_t pix) { return 0; }
+    virtual uint32_t getPowerSum(bool maxRGB);  // WLEDMM ABL: sum of r+g+b+w over all LEDs (maxRGB: 3*max(r,g,b) per LED), as seen by getPixelColor()
     virtual void     setBrightness(uint8_t b, bool immediate=false) { _bri = b; };
     virtual void     cleanup() = 0;
     virtual uint8_t  getPins(uint8_t* pinArray) { return 0; }
     virtual uint16_t getLength() { return _len; }
     virtual void     setColorOrder() {}
+    virtual void     compileColorOrder() {} // WLEDMM called when the color order map has changed
     virtual uint8_t  getColorOrder() { return COL_ORDER_RGB; }
     virtual uint8_t  skippedLeds() { return 0; }
     virtual uint16_t getFrequency() { return 0U; }
+    virtual uint16_t getUniverse() { return 0U; }       // WLEDMM E1.31 network bus only
+    virtual uint16_t getStartChannel() { return 0U; }   // WLEDMM E1.31 network bus only
     inline  uint16_t getStart() { return _start; }
     inline  void     setStart(uint16_t start) { _start = start; }
     inline  uint8_t  getType() { return _type; }
     inline  bool     isOk() { return _valid; }
     inline  bool     isOffRefreshRequired() { return _needsRefresh; }
+    inline  bool     isVirtual() { return (_type >= TYPE_NET_DDP_RGB) && (_type < 96); }  // WLEDMM network bus
+    inline  unsigned long lastShown() const { return _shownAt; }
+    // WLEDMM frame change detection: every write is folded into a hash, show() is skipped when hash and brightness match the last transmitted frame
+    // (one hash per render worker, so parallel segment rendering does not race on it)
+    inline  void     hashPixel(uint16_t pix, uint32_t c) {
+      const unsigned w = FX_WORKER_ID;
+      _frameHash[w] = (_frameHash[w] ^ c) * 16777619U; _frameHash[w] = (_frameHash[w] ^ pix) * 16777619U; _frameWrites[w] = true;
+    }
+    inline  bool     frameChanged() const {
+      if (!_frameShown || (_bri != _shownBri)) return true;
+      for (unsigned w = 0; w < WLED_RENDER_WORKERS; w++) if (_frameWrites[w] && (_frameHash[w] != _shownHash[w])) return true;
+      return false;
+    }
+    inline  void     frameDone(bool sent, unsigned long now) {
+      if (sent) { _shownBri = _bri; _frameShown = true; _shownAt = now; }
+      for (unsigned w = 0; w < WLED_RENDER_WORKERS; w++) {
+        if (sent) _shownHash[w] = _frameHash[w];
+        _frameHash[w] = 2166136261U; _frameWrites[w] = false;
+      }
+    }
             bool     containsPixel(uint16_t pix) { return pix >= _start && pix < _start+_len; }
     virtual uint16_t getMaxPixels() { return MAX_LEDS_PER_BUS; };
 
@@ -145,9 +197,13 @@ class Bus {
           _type == TYPE_ANALOG_2CH    || _type == TYPE_ANALOG_5CH) return true;
       return false;
     }
+    // WLEDMM CCT of the segment being rendered, kept per render worker (segments on the other core have their own CCT)
     static void setCCT(uint16_t cct) {
-      _cct = cct;
+      const unsigned w = FX_WORKER_ID;
+      _cct[w] = cct;
+      if ((_cct[w] >= 1900) && (_cct[w] != _wbKelvin[w])) buildWhiteBalanceLUT(w); // WLEDMM once per CCT change, not once per pixel
     }
+    static inline int16_t workerCCT() { return _cct[FX_WORKER_ID]; }
     static void setCCTBlend(uint8_t b) {
       if (b > 100) b = 100;
       _cctBlend = (b * 127) / 100;
@@ -171,11 +227,24 @@ class Bus {
     bool     _valid;
     bool     _needsRefresh;
     uint8_t  _autoWhiteMode;
+    uint32_t _frameHash[WLED_RENDER_WORKERS]; // WLEDMM set up in the constructor
+    uint32_t _shownHash[WLED_RENDER_WORKERS];
+    uint8_t  _shownBri = 0;
+    bool     _frameWrites[WLED_RENDER_WORKERS];
+    bool     _frameShown = false;
+    unsigned long _shownAt = 0;     // WLEDMM millis() of the last transmitted frame
     static uint8_t _gAWM;
-    static int16_t _cct;
+    static int16_t _cct[WLED_RENDER_WORKERS];        // WLEDMM one per render worker, see setCCT()
     static uint8_t _cctBlend;
+    static int16_t _wbKelvin[WLED_RENDER_WORKERS];   // WLEDMM CCT the white balance LUT was built for
+    static uint8_t _wbLUT[WLED_RENDER_WORKERS][3][256]; // WLEDMM white balance correction per channel, see colorBalanceFromKelvin()
 
     uint32_t autoWhiteCalc(uint32_t c);
+    static void buildWhiteBalanceLUT(unsigned w);
+    static inline uint32_t whiteBalance(uint32_t c) { // WLEDMM integer replacement for colorBalanceFromKelvin(workerCCT(), c)
+      const uint8_t (&lut)[3][256] = _wbLUT[FX_WORKER_ID];
+      return (uint32_t(lut[0][byte(c >> 16)]) << 16) | (uint32_t(lut[1][byte(c >> 8)]) << 8) | lut[2][byte(c)] | (c & 0xFF000000);
+    }
 };
 
 
@@ -187,14 +256,24 @@ class BusDigital : public Bus {
 
     bool canShow();
 
+#ifdef WLEDMM_BUS_BUFFER
+    bool canRender() { return _data || canShow(); } // WLEDMM _data is the back buffer; without it, effects write the driver buffer
+#else
+    bool canRender() { return canShow(); }
+#endif
+
     void setBrightness(uint8_t b, bool immediate);
 
     void setStatusPixel(uint32_t c);
 
     void setPixelColor(uint16_t pix, uint32_t c);
 
+    void setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n);
+
     uint32_t getPixelColor(uint16_t pix);
 
+    uint32_t getPowerSum(bool maxRGB);
+
     uint8_t getColorOrder() {
       return _colorOrder;
     }
@@ -207,6 +286,8 @@ class BusDigital : public Bus {
 
     void setColorOrder(uint8_t colorOrder);
 
+    void compileColorOrder();
+
     uint8_t skippedLeds() {
       return _skip;
     }
@@ -229,6 +310,24 @@ class BusDigital : public Bus {
     uint16_t _frequencykHz = 0U;
     void * _busPtr = nullptr;
     const ColorOrderMap &_colorOrderMap;
+    ColorOrderRun _coRuns[WLED_MAX_COLOR_ORDER_RUNS] = {{UINT16_MAX, COL_ORDER_GRB}}; // WLEDMM _colorOrderMap compiled for this bus, sorted, covers all LEDs
+    uint8_t _coRunCount = 1;
+
+    // WLEDMM color order of physical LED pix; r is a cursor into _coRuns, so stepping through a span costs O(1) per LED
+    inline uint8_t colorOrderAt(uint16_t pix, unsigned &r) const {
+      while ((pix >= _coRuns[r].end) && (r+1 < _coRunCount)) r++;
+      while ((r > 0) && (pix < _coRuns[r-1].end)) r--;
+      return _coRuns[r].colorOrder;
+    }
+#ifdef WLEDMM_BUS_BUFFER
+    uint32_t * _data = nullptr;  // WLEDMM back buffer: RGBW per LED (auto-white and white balance applied), packed into the driver (front) buffer by show()
+    void packBuffer();
+    // WLEDMM write transform for _data: auto-white first, then white balance - the CCT belongs to the segment being rendered
+    inline uint32_t bufferColor(uint32_t c) {
+      if (_type == TYPE_SK6812_RGBW || _type == TYPE_TM1814 || _type == TYPE_WS2812_1CH_X3) c = autoWhiteCalc(c);
+      return (workerCCT() >= 1900) ? whiteBalance(c) : c;
+    }
+#endif
 };
 
 
@@ -293,6 +392,9 @@ class BusOnOff : public Bus {
 };
 
 
+// WLEDMM a 4096 pixel network bus spans up to 33 E1.31 universes (128 RGBW pixels each, plus one for the start channel offset)
+#define E131_OUT_MAX_UNIVERSES 33
+
 class BusNetwork : public Bus {
   public:
     BusNetwork(BusConfig &bc);
@@ -303,6 +405,8 @@ class BusNetwork : public Bus {
 
     void setPixelColor(uint16_t pix, uint32_t c);
 
+    void setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n);
+
     uint32_t __attribute__((pure)) getPixelColor(uint16_t pix);  // WLEDMM attribute added
 
     void show();
@@ -318,6 +422,9 @@ class BusNetwork : public Bus {
       return _len;
     }
 
+    uint16_t getUniverse() { return (_UDPtype == 1) ? _universe : 0; }
+    uint16_t getStartChannel() { return (_UDPtype == 1) ? _channel : 0; }
+
     void cleanup();
 
     ~BusNetwork() {
@@ -331,6 +438,9 @@ class BusNetwork : public Bus {
     bool      _rgbw;
     bool      _broadcastLock;
     byte     *_data;
+    uint16_t  _universe;                      // WLEDMM E1.31 start universe and channel
+    uint16_t  _channel;
+    uint8_t   _sequence[E131_OUT_MAX_UNIVERSES] = {0}; // WLEDMM E1.31 sequence number per universe of this bus
 };
 
 #ifdef WLED_ENABLE_HUB75MATRIX
@@ -345,6 +455,8 @@ class BusHub75Matrix : public Bus {
 
     void setPixelColor(uint16_t pix, uint32_t c);
 
+    void setPixelSpan(uint16_t pix, const uint32_t *c, uint16_t n);
+
     void show() {
       if(mxconfig.double_buff) {
         display->flipDMABuffer(); // Show the back buffer, set currently output buffer to the back (i.e. no longer being sent to LED panels)
@@ -400,6 +512,8 @@ class BusManager {
 
     void setPixelColor(uint16_t pix, uint32_t c, int16_t cct=-1);
 
+    void setPixelColors(uint16_t start, const uint32_t *c, uint16_t n); // WLEDMM write n consecutive pixels, may cross bus boundaries
+
     void setBrightness(uint8_t b, bool immediate=false);          // immediate=true is for use in ABL, it applies brightness immediately (warning: inefficient)
 
     void setSegmentCCT(int16_t cct, bool allowWBCorrection = false);
@@ -408,13 +522,17 @@ class BusManager {
 
     bool canAllShow();
 
+    bool canAllRender(); // WLEDMM pipelined show: true if the next frame can be rendered while the busses are still sending
+
     Bus* getBus(uint8_t busNr);
 
     //semi-duplicate of strip.getLengthTotal() (though that just returns strip._length, calculated in finalizeInit())
     uint16_t getTotalLength();
 
+    // may be called from the async web task: the per-bus run tables are rebuilt by the next show() (loop task)
     inline void updateColorOrderMap(const ColorOrderMap &com) {
       memcpy(&colorOrderMap, &com, sizeof(ColorOrderMap));
+      colorOrderMapChanged = true; // WLEDMM
     }
 
     inline const ColorOrderMap& getColorOrderMap() const {
@@ -425,14 +543,39 @@ class BusManager {
       return numBusses;
     }
 
+    uint32_t framesSent = 0;    // WLEDMM frames where at least one bus was transmitted
+    uint32_t framesSkipped = 0; // WLEDMM frames where no bus content or brightness changed
+
   private:
     uint8_t numBusses = 0;
     Bus* busses[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES] = {nullptr}; // WLEDMM init array
     ColorOrderMap colorOrderMap;
-    // WLEDMM cache last used Bus -> 20% to 30% speedup when using many LED pins
-    Bus *lastBus = nullptr;
-    unsigned laststart = 0;
-    unsigned lastend = 0;
+    volatile bool colorOrderMapChanged = false; // WLEDMM busses need compileColorOrder()
+    // WLEDMM pixel -> bus routing table (physical and virtual busses), sorted by start; rebuilt by add() and removeAll()
+    // Ranges are disjoint: where busses overlap, the bus added first owns the LEDs (as the old linear search did), so a bus
+    // nested inside another one splits it into two routes. n busses never need more than 2n-1 routes.
+    #define WLED_MAX_BUS_ROUTES (2*(WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES))
+    uint16_t routeStart[WLED_MAX_BUS_ROUTES] = {0};
+    uint16_t routeEnd[WLED_MAX_BUS_ROUTES] = {0};
+    Bus*     routeBus[WLED_MAX_BUS_ROUTES] = {nullptr};
+    uint8_t  numRoutes = 0;
+
+    void buildRoutes();
+    void addRoute(unsigned start, unsigned end, Bus *b);
+
+    // WLEDMM bus owning pixel pix (or nullptr); branch-free binary search for the last route starting at or before pix
+    inline Bus* findBus(uint_fast16_t pix, uint_fast16_t &bstart) const {
+      if ((numRoutes == 0) || (pix < routeStart[0])) return nullptr;
+      unsigned base = 0, n = numRoutes;
+      while (n > 1) {
+        unsigned half = n / 2;
+        base = (routeStart[base + half] <= pix) ? base + half : base;
+        n -= half;
+      }
+      if (pix >= routeEnd[base]) return nullptr; // gap between busses
+      bstart = routeBus[base]->getStart();      // a route can begin inside its bus
+      return routeBus[base];
+    }
 
     inline uint8_t getNumVirtualBusses() {
       int j = 0;
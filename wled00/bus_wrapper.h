@@ -1050,6 +1050,68 @@ class PolyBus {
     return 0;
   }
 
+  // WLEDMM raw pixel buffer of clockless busses that store plain 8bit channels (NPB-LG: brightness already applied). nullptr for all other types.
+  static uint8_t* getPixels(void* busPtr, uint8_t busType, uint8_t &pixelSize) {
+    switch (busType) {
+    #ifdef ESP8266
+      case I_8266_U0_NEO_3: pixelSize = (static_cast<B_8266_U0_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_U0_NEO_3*>(busPtr))->Pixels();
+      case I_8266_U1_NEO_3: pixelSize = (static_cast<B_8266_U1_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_U1_NEO_3*>(busPtr))->Pixels();
+      case I_8266_DM_NEO_3: pixelSize = (static_cast<B_8266_DM_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_DM_NEO_3*>(busPtr))->Pixels();
+      case I_8266_BB_NEO_3: pixelSize = (static_cast<B_8266_BB_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_BB_NEO_3*>(busPtr))->Pixels();
+      case I_8266_U0_NEO_4: pixelSize = (static_cast<B_8266_U0_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_U0_NEO_4*>(busPtr))->Pixels();
+      case I_8266_U1_NEO_4: pixelSize = (static_cast<B_8266_U1_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_U1_NEO_4*>(busPtr))->Pixels();
+      case I_8266_DM_NEO_4: pixelSize = (static_cast<B_8266_DM_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_DM_NEO_4*>(busPtr))->Pixels();
+      case I_8266_BB_NEO_4: pixelSize = (static_cast<B_8266_BB_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_BB_NEO_4*>(busPtr))->Pixels();
+      case I_8266_U0_400_3: pixelSize = (static_cast<B_8266_U0_400_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_U0_400_3*>(busPtr))->Pixels();
+      case I_8266_U1_400_3: pixelSize = (static_cast<B_8266_U1_400_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_U1_400_3*>(busPtr))->Pixels();
+      case I_8266_DM_400_3: pixelSize = (static_cast<B_8266_DM_400_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_DM_400_3*>(busPtr))->Pixels();
+      case I_8266_BB_400_3: pixelSize = (static_cast<B_8266_BB_400_3*>(busPtr))->PixelSize(); return (static_cast<B_8266_BB_400_3*>(busPtr))->Pixels();
+      case I_8266_U0_TM1_4: pixelSize = (static_cast<B_8266_U0_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_U0_TM1_4*>(busPtr))->Pixels();
+      case I_8266_U1_TM1_4: pixelSize = (static_cast<B_8266_U1_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_U1_TM1_4*>(busPtr))->Pixels();
+      case I_8266_DM_TM1_4: pixelSize = (static_cast<B_8266_DM_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_DM_TM1_4*>(busPtr))->Pixels();
+      case I_8266_BB_TM1_4: pixelSize = (static_cast<B_8266_BB_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_BB_TM1_4*>(busPtr))->Pixels();
+      case I_8266_U0_TM2_3: pixelSize = (static_cast<B_8266_U0_TM2_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_U0_TM2_4*>(busPtr))->Pixels();
+      case I_8266_U1_TM2_3: pixelSize = (static_cast<B_8266_U1_TM2_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_U1_TM2_4*>(busPtr))->Pixels();
+      case I_8266_DM_TM2_3: pixelSize = (static_cast<B_8266_DM_TM2_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_DM_TM2_4*>(busPtr))->Pixels();
+      case I_8266_BB_TM2_3: pixelSize = (static_cast<B_8266_BB_TM2_4*>(busPtr))->PixelSize(); return (static_cast<B_8266_BB_TM2_4*>(busPtr))->Pixels();
+    #endif
+    #ifdef ARDUINO_ARCH_ESP32
+      case I_32_RN_NEO_3: pixelSize = (static_cast<B_32_RN_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_32_RN_NEO_3*>(busPtr))->Pixels();
+      #ifndef WLED_NO_I2S0_PIXELBUS
+      case I_32_I0_NEO_3: pixelSize = (static_cast<B_32_I0_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_32_I0_NEO_3*>(busPtr))->Pixels();
+      #endif
+      #ifndef WLED_NO_I2S1_PIXELBUS
+      case I_32_I1_NEO_3: pixelSize = (static_cast<B_32_I1_NEO_3*>(busPtr))->PixelSize(); return (static_cast<B_32_I1_NEO_3*>(busPtr))->Pixels();
+      #endif
+      case I_32_RN_NEO_4: pixelSize = (static_cast<B_32_RN_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_32_RN_NEO_4*>(busPtr))->Pixels();
+      #ifndef WLED_NO_I2S0_PIXELBUS
+      case I_32_I0_NEO_4: pixelSize = (static_cast<B_32_I0_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_32_I0_NEO_4*>(busPtr))->Pixels();
+      #endif
+      #ifndef WLED_NO_I2S1_PIXELBUS
+      case I_32_I1_NEO_4: pixelSize = (static_cast<B_32_I1_NEO_4*>(busPtr))->PixelSize(); return (static_cast<B_32_I1_NEO_4*>(busPtr))->Pixels();
+      #endif
+      case I_32_RN_400_3: pixelSize = (static_cast<B_32_RN_400_3*>(busPtr))->PixelSize(); return (static_cast<B_32_RN_400_3*>(busPtr))->Pixels();
+      #ifndef WLED_NO_I2S0_PIXELBUS
+      case I_32_I0_400_3: pixelSize = (static_cast<B_32_I0_400_3*>(busPtr))->PixelSize(); return (static_cast<B_32_I0_400_3*>(busPtr))->Pixels();
+      #endif
+      #ifndef WLED_NO_I2S1_PIXELBUS
+      case I_32_I1_400_3: pixelSize = (static_cast<B_32_I1_400_3*>(busPtr))->PixelSize(); return (static_cast<B_32_I1_400_3*>(busPtr))->Pixels();
+      #endif
+      case I_32_RN_TM1_4: pixelSize = (static_cast<B_32_RN_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_32_RN_TM1_4*>(busPtr))->Pixels();
+      case I_32_RN_TM2_3: pixelSize = (static_cast<B_32_RN_TM2_3*>(busPtr))->PixelSize(); return (static_cast<B_32_RN_TM2_3*>(busPtr))->Pixels();
+      #ifndef WLED_NO_I2S0_PIXELBUS
+      case I_32_I0_TM1_4: pixelSize = (static_cast<B_32_I0_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_32_I0_TM1_4*>(busPtr))->Pixels();
+      case I_32_I0_TM2_3: pixelSize = (static_cast<B_32_I0_TM2_3*>(busPtr))->PixelSize(); return (static_cast<B_32_I0_TM2_3*>(busPtr))->Pixels();
+      #endif
+      #ifndef WLED_NO_I2S1_PIXELBUS
+      case I_32_I1_TM1_4: pixelSize = (static_cast<B_32_I1_TM1_4*>(busPtr))->PixelSize(); return (static_cast<B_32_I1_TM1_4*>(busPtr))->Pixels();
+      case I_32_I1_TM2_3: pixelSize = (static_cast<B_32_I1_TM2_3*>(busPtr))->PixelSize(); return (static_cast<B_32_I1_TM2_3*>(busPtr))->Pixels();
+      #endif
+    #endif
+    }
+    pixelSize = 0;
+    return nullptr;
+  };
   static void cleanup(void* busPtr, uint8_t busType) {
     if (busPtr == nullptr) return;
     switch (busType) {
@@ -194,13 +194,15 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
       uint16_t freqkHz = elm[F("freq")] | 0;  // will be in kHz for DotStar and Hz for PWM (not yet implemented fully)
       ledType |= refresh << 7; // hack bit 7 to indicate strip requires off refresh
       uint8_t AWmode = elm[F("rgbwm")] | RGBW_MODE_MANUAL_ONLY;
+      uint16_t universe = elm[F("uni")] | 1;   // WLEDMM E1.31 network bus
+      uint16_t channel = elm[F("addr")] | 1;
       if (fromFS) {
-        BusConfig bc = BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz);
+        BusConfig bc = BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, freqkHz, universe, channel);
         mem += BusManager::memUsage(bc);
         if (mem <= MAX_LED_MEMORY) if (busses.add(bc) == -1) break;  // finalization will be done in WLED::beginStrip()
       } else {
         if (busConfigs[s] != nullptr) delete busConfigs[s];
-        busConfigs[s] = new BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode);
+        busConfigs[s] = new BusConfig(ledType, pins, start, length, colorOrder, reversed, skipFirst, AWmode, 0U, universe, channel);
         busesChanged = true;
       }
       s++;
@@ -461,6 +463,13 @@ bool deserializeConfig(JsonObject doc, bool fromFS) {
   if (e131Priority > 200) e131Priority = 200;
   CJSON(DMXMode, if_live_dmx["mode"]);
 
+  JsonObject if_live_e131out = if_live[F("e131out")]; // WLEDMM E1.31 output of network busses
+  CJSON(e131OutPriority, if_live_e131out[F("prio")]);
+  if (e131OutPriority > 200) e131OutPriority = 200;
+  CJSON(e131OutMulticast, if_live_e131out[F("mc")]);
+  CJSON(e131OutSyncUniverse, if_live_e131out[F("sync")]);
+  if (e131OutSyncUniverse > 63999) e131OutSyncUniverse = 0;
+
   tdd = if_live[F("timeout")] | -1;
   if (tdd >= 0) realtimeTimeoutMs = tdd * 100;
 
@@ -828,6 +837,10 @@ void serializeConfig() {
     ins["ref"] = bus->isOffRefreshRequired();
     ins[F("rgbwm")] = bus->getAutoWhiteMode();
     ins[F("freq")] = bus->getFrequency();
+    if (bus->getUniverse()) { // WLEDMM E1.31 network bus
+      ins[F("uni")] = bus->getUniverse();
+      ins[F("addr")] = bus->getStartChannel();
+    }
   }
 
   JsonArray hw_com = hw.createNestedArray(F("com"));
@@ -954,6 +967,11 @@ void serializeConfig() {
   if_live_dmx[F("addr")] = DMXAddress;
   if_live_dmx[F("dss")] = DMXSegmentSpacing;
   if_live_dmx["mode"] = DMXMode;
+
+  JsonObject if_live_e131out = if_live.createNestedObject(F("e131out"));
+  if_live_e131out[F("prio")] = e131OutPriority;
+  if_live_e131out[F("mc")]   = e131OutMulticast;
+  if_live_e131out[F("sync")] = e131OutSyncUniverse;
   #ifdef WLED_ENABLE_DMX_INPUT
     if_live_dmx[F("inputRxPin")] = dmxInputTransmitPin;
     if_live_dmx[F("inputTxPin")] = dmxInputReceivePin;
@@ -66,6 +66,19 @@
   #endif
 #endif
 
+// WLEDMM parallel segment rendering: a second render worker runs on the other core of dual-core ESP32
+#if defined(WLEDMM_PARALLEL_SEGMENTS) && (!defined(ARDUINO_ARCH_ESP32) || defined(CONFIG_FREERTOS_UNICORE))
+  #undef WLEDMM_PARALLEL_SEGMENTS
+#endif
+#ifdef WLEDMM_PARALLEL_SEGMENTS
+  #define WLED_RENDER_WORKERS 2
+  extern __thread uint8_t fxWorkerId;     // render worker of the current task (0 = main loop and all other tasks)
+  #define FX_WORKER_ID fxWorkerId
+#else
+  #define WLED_RENDER_WORKERS 1
+  #define FX_WORKER_ID 0
+#endif
+
 #ifndef WLED_MAX_BUTTONS
   #ifdef ESP8266
     #define WLED_MAX_BUTTONS 2
@@ -249,7 +262,7 @@
 
 //Network types (master broadcast) (80-95)
 #define TYPE_NET_DDP_RGB         80            //network DDP RGB bus (master broadcast bus)
-#define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus, unused)
+#define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus)
 #define TYPE_NET_ARTNET_RGB      82            //network ArtNet RGB bus (master broadcast bus, unused)
 #define TYPE_NET_DDP_RGBW        88            //network DDP RGBW bus (master broadcast bus)
 
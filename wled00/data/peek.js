@@ -21,12 +21,13 @@ function peek(c) {
 			try {
 				if (toString.call(e.data) === '[object ArrayBuffer]') {
 					let leds = new Uint8Array(e.data);
-					if (leds[0] != 76 || leds[1] != 2 || !ctx) return; //'L', set in ws.cpp
-					let mW = leds[2]; // matrix width
-					let mH = leds[3]; // matrix height
+					if (leds[0] != 76 || (leds[1] != 2 && leds[1] != 3) || !ctx) return; //'L', set in ws.cpp
+					let v3 = leds[1] == 3; //WLEDMM version 3: 16 bit width & height
+					let mW = v3 ? (leds[2]<<8 | leds[3]) : leds[2]; // matrix width
+					let mH = v3 ? (leds[4]<<8 | leds[5]) : leds[3]; // matrix height
 					let pPL = Math.min(c.width / mW, c.height / mH); // pixels per LED (width of circle)
 					let lOf = Math.floor((c.width - pPL*mW)/2); //left offset (to center matrix)
-					var i = 4; //same offset as in ws.cpp
+					var i = v3 ? 6 : 4; //same offset as in ws.cpp
 					ctx.clearRect(0, 0, c.width, c.height); //WLEDMM
 					function colorAmp(color) {
 						if (color == 0) return 0;
@@ -37,10 +37,7 @@ void handleDDPPacket(e131_packet_t* p) {
   realtimeLock(realtimeTimeoutMs, REALTIME_MODE_DDP);
 
   if (!realtimeOverride || (realtimeMode && useMainSegmentOnly)) {
-    for (uint16_t i = start; i < stop; i++) {
-      setRealtimePixel(i, data[c], data[c+1], data[c+2], ddpChannelsPerLed >3 ? data[c+3] : 0);
-      c += ddpChannelsPerLed;
-    }
+    if (uint16_t(start) < stop) setRealtimePixels(start, &data[c], stop - uint16_t(start), ddpChannelsPerLed); // WLEDMM span write
   }
 
   bool push = p->flags & DDP_PUSH_FLAG;
@@ -319,17 +316,8 @@ void handleDMXData(uint16_t uni, uint16_t dmxChannels, uint8_t* e131_data, uint8
           }
         }
 
-        if (!is4Chan) {
-          for (uint16_t i = previousLeds; i < ledsTotal; i++) {
-            setRealtimePixel(i, e131_data[dmxOffset], e131_data[dmxOffset+1], e131_data[dmxOffset+2], 0);
-            dmxOffset+=3;
-          }
-        } else {
-          for (uint16_t i = previousLeds; i < ledsTotal; i++) {
-            setRealtimePixel(i, e131_data[dmxOffset], e131_data[dmxOffset+1], e131_data[dmxOffset+2], e131_data[dmxOffset+3]);
-            dmxOffset+=4;
-          }
-        }
+        if (previousLeds < ledsTotal) // WLEDMM span write
+          setRealtimePixels(previousLeds, &e131_data[dmxOffset], ledsTotal - previousLeds, is4Chan ? 4 : 3);
         break;
       }
     default:
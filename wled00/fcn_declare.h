@@ -148,6 +148,9 @@ bool deserializeState(JsonObject root, byte callMode = CALL_MODE_DIRECT_CHANGE,
 void serializeSegment(JsonObject& root, Segment& seg, byte id, bool forPreset = false, bool segmentBounds = true);
 void serializeState(JsonObject root, bool forPreset = false, bool includeBri = true, bool segmentBounds = true, bool selectedSegmentsOnly = false);
 void serializeInfo(JsonObject root);
+#ifdef WLEDMM_PROFILER
+void serializeProfile(JsonObject root); // WLEDMM frame time statistics
+#endif
 void serializeModeNames(JsonArray arr, const char *qstring);
 void serializeModeData(JsonObject root);
 void serveJson(AsyncWebServerRequest* request);
@@ -240,11 +243,13 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply=tru
 
 //udp.cpp
 void notify(byte callMode, bool followUp=false);
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri=255, bool isRGBW=false, uint16_t universe=1, uint16_t channel=1, uint8_t *sequence=nullptr);
+void e131OutSync();
 void realtimeLock(uint32_t timeoutMs, byte md = REALTIME_MODE_GENERIC);
 void exitRealtime();
 void handleNotifications();
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w);
+void setRealtimePixels(uint16_t i, const byte *data, uint16_t count, uint8_t channels); // WLEDMM span version
 void refreshNodeList();
 void sendSysInfoUDP();
 
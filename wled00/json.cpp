@@ -894,6 +894,34 @@ String restartCode2Info(esp_reset_reason_t reason) {
 #endif
 // end WLEDMM
 
+#ifdef WLEDMM_PROFILER
+// WLEDMM frame time statistics (microseconds)
+static void serializeFrameTime(JsonObject root, const frametime_stats_t &st)
+{
+  root["n"]   = st.count;
+  root[F("min")] = st.count ? st.minUs : 0;
+  root[F("avg")] = st.avg();
+  root[F("max")] = st.maxUs;
+  root[F("p95")] = st.percentile(95);
+}
+
+void serializeProfile(JsonObject root)
+{
+  serializeFrameTime(root.createNestedObject(F("show")), strip.profShow);
+  serializeFrameTime(root.createNestedObject(F("abl")),  strip.profAbl);
+  serializeFrameTime(root.createNestedObject(F("ovl")),  strip.profOverlay);
+  JsonArray segs = root.createNestedArray("seg");
+  for (size_t s = 0; s < strip.getSegmentsNum() && s < MAX_NUM_SEGMENTS; s++) {
+    const frametime_stats_t &st = strip.profSeg[s];
+    if (st.count == 0) continue;
+    JsonObject seg = segs.createNestedObject();
+    seg["id"] = s;
+    seg["fx"] = st.fx;
+    serializeFrameTime(seg, st);
+  }
+}
+#endif
+
 void serializeInfo(JsonObject root)
 {
   root[F("ver")] = versionString;
@@ -907,6 +935,8 @@ void serializeInfo(JsonObject root)
   leds[F("countP")] = strip.getLengthPhysical(); //WLEDMM
   leds[F("pwr")] = strip.currentMilliamps;
   leds["fps"] = strip.getFps();
+  leds[F("fsent")] = busses.framesSent;    // WLEDMM frames transmitted
+  leds[F("fskip")] = busses.framesSkipped; // WLEDMM frames skipped because nothing changed
   leds[F("maxpwr")] = (strip.currentMilliamps)? strip.ablMilliampsMax : 0;
   leds[F("maxseg")] = strip.getMaxSegments();
   //leds[F("actseg")] = strip.getActiveSegmentsNum();
@@ -1137,6 +1167,10 @@ void serializeInfo(JsonObject root)
   #endif
   // end WLEDMM
 
+  #ifdef WLEDMM_PROFILER
+  serializeProfile(root.createNestedObject(F("prof")));
+  #endif
+
   root[F("uptime")] = millis()/1000 + rolloverMillis*4294967;
 
   usermods.addToJsonInfo(root);
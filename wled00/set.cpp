@@ -121,6 +121,8 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       char aw[4] = "AW"; aw[2] = 48+s; aw[3] = 0; //auto white mode
       char wo[4] = "WO"; wo[2] = 48+s; wo[3] = 0; //channel swap
       char sp[4] = "SP"; sp[2] = 48+s; sp[3] = 0; //bus clock speed (DotStar & PWM)
+      char eu[4] = "EU"; eu[2] = 48+s; eu[3] = 0; //E1.31 start universe (network bus)
+      char ea[4] = "EA"; ea[2] = 48+s; ea[3] = 0; //E1.31 start channel (network bus)
       if (!request->hasArg(lp)) {
         DEBUG_PRINT(F("No data for "));
         DEBUG_PRINTLN(s);
@@ -168,7 +170,9 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
       // actual finalization is done in WLED::loop() (removing old busses and adding new)
       // this may happen even before this loop is finished so we do "doInitBusses" after the loop
       if (busConfigs[s] != nullptr) delete busConfigs[s];
-      busConfigs[s] = new BusConfig(type, pins, start, length, colorOrder | (channelSwap<<4), request->hasArg(cv), skip, awmode, freqHz);
+      uint16_t universe = request->hasArg(eu) ? request->arg(eu).toInt() : 1;
+      uint16_t channel = request->hasArg(ea) ? request->arg(ea).toInt() : 1;
+      busConfigs[s] = new BusConfig(type, pins, start, length, colorOrder | (channelSwap<<4), request->hasArg(cv), skip, awmode, freqHz, universe, channel);
       busesChanged = true;
     }
     //doInitBusses = busesChanged; // we will do that below to ensure all input data is processed
@@ -350,6 +354,12 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     if (t >= 0  && t <= 200) e131Priority = t;
     t = request->arg(F("DM")).toInt();
     if (t >= DMX_MODE_DISABLED && t <= DMX_MODE_PRESET) DMXMode = t;
+    // WLEDMM E1.31 output
+    t = request->arg(F("EOP")).toInt();
+    if (t >= 0 && t <= 200) e131OutPriority = t;
+    e131OutMulticast = request->hasArg(F("EOM"));
+    t = request->arg(F("EOS")).toInt();
+    if (t >= 0 && t <= 63999) e131OutSyncUniverse = t;
     t = request->arg(F("ET")).toInt();
     if (t > 99  && t <= 65000) realtimeTimeoutMs = t;
     arlsForceMaxBri = request->hasArg(F("FB"));
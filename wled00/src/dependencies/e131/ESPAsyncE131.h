@@ -26,7 +26,7 @@
 #ifndef ESPASYNCE131_H_
 #define ESPASYNCE131_H_
 
-#ifdef ESP32
+#if defined(ESP32) || defined(WLED_NATIVE) // WLEDMM native: host build with shims (test/native)
 #include <WiFi.h>
 #include <AsyncUDP.h>
 #elif defined (ESP8266)
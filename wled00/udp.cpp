@@ -530,14 +530,9 @@ void handleNotifications()
 
     uint16_t id = (tpmPayloadFrameSize/3)*(packetNum-1); //start LED
     uint16_t totalLen = strip.getLengthTotal();
-    for (size_t i = 6; i < tpmPayloadFrameSize + 4U; i += 3)
-    {
-      if (id < totalLen)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-        id++;
-      }
-      else break;
+    if (id < totalLen && tpmPayloadFrameSize + 4U > 6) {
+      unsigned count = min(unsigned(tpmPayloadFrameSize + 4U - 6 + 2) / 3, unsigned(totalLen - id));
+      setRealtimePixels(id, &udpIn[6], count, 3); // WLEDMM span write
     }
     if (tpmPacketCount == numPackets) //reset packet count and show if all packets were received
     {
@@ -572,40 +567,20 @@ void handleNotifications()
       }
     } else if (udpIn[0] == 2 && packetSize > 4) //drgb
     {
-      uint16_t id = 0;
-      for (int i = 2; i < packetSize -2; i += 3)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-
-        id++; if (id >= totalLen) break;
-      }
+      unsigned count = min(unsigned(packetSize - 2) / 3, unsigned(totalLen)); // WLEDMM span write
+      setRealtimePixels(0, &udpIn[2], count, 3);
     } else if (udpIn[0] == 3 && packetSize > 6) //drgbw
     {
-      uint16_t id = 0;
-      for (int i = 2; i < packetSize -3; i += 4)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], udpIn[i+3]);
-
-        id++; if (id >= totalLen) break;
-      }
+      unsigned count = min(unsigned(packetSize - 2) / 4, unsigned(totalLen));
+      setRealtimePixels(0, &udpIn[2], count, 4);
     } else if (udpIn[0] == 4 && packetSize > 7) //dnrgb
     {
       uint16_t id = ((udpIn[3] << 0) & 0xFF) + ((udpIn[2] << 8) & 0xFF00);
-      for (int i = 4; i < packetSize -2; i += 3)
-      {
-        if (id >= totalLen) break;
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-        id++;
-      }
+      if (id < totalLen) setRealtimePixels(id, &udpIn[4], min(unsigned(packetSize - 4) / 3, unsigned(totalLen - id)), 3);
     } else if (udpIn[0] == 5 && packetSize > 8) //dnrgbw
     {
       uint16_t id = ((udpIn[3] << 0) & 0xFF) + ((udpIn[2] << 8) & 0xFF00);
-      for (int i = 4; i < packetSize -2; i += 4)
-      {
-        if (id >= totalLen) break;
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], udpIn[i+3]);
-        id++;
-      }
+      if (id < totalLen) setRealtimePixels(id, &udpIn[4], min(unsigned(packetSize - 4) / 4, unsigned(totalLen - id)), 4);
     }
     strip.show();
     return;
@@ -648,6 +623,37 @@ void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
   }
 }
 
+// WLEDMM span version of setRealtimePixel(): "count" pixels of "channels" bytes each (3 = RGB, 4 = RGBW), starting at pixel i
+void setRealtimePixels(uint16_t i, const byte *data, uint16_t count, uint8_t channels)
+{
+  int pix = int(i) + arlsOffset;
+  if (pix < 0) { // skip pixels that would land before the strip start
+    if (-pix >= count) return;
+    data  += -pix * channels;
+    count -= -pix;
+    pix = 0;
+  }
+  const int totalLen = strip.getLengthTotal();
+  Segment *seg = useMainSegmentOnly ? &strip.getMainSegment() : nullptr;
+  const int maxLen = seg ? min(totalLen, int(seg->length())) : totalLen;
+  if (pix >= maxLen) return;
+  if (pix + count > maxLen) count = maxLen - pix;
+
+  const bool doGamma = !arlsDisableGammaCorrection && gammaCorrectCol;
+  uint32_t buf[PIXEL_SPAN_CHUNK];
+  while (count > 0) {
+    const unsigned cnt = min(unsigned(count), unsigned(PIXEL_SPAN_CHUNK));
+    for (unsigned k = 0; k < cnt; k++, data += channels) {
+      byte w = (channels > 3) ? data[3] : 0;
+      if (doGamma) buf[k] = RGBW32(gamma8(data[0]), gamma8(data[1]), gamma8(data[2]), gamma8(w));
+      else         buf[k] = RGBW32(data[0], data[1], data[2], w);
+    }
+    if (seg) seg->setPixelColors(pix, buf, cnt);
+    else     strip.setPixelColors(pix, buf, cnt);
+    pix += cnt; count -= cnt;
+  }
+}
+
 /*********************************************************************************************\
    Refresh aging for remote units, drop if too old...
 \*********************************************************************************************/
@@ -757,15 +763,106 @@ void sendSysInfoUDP()
 // length - the number of pixels
 // buffer - a buffer of at least length*4 bytes long
 // isRGBW - true if the buffer contains 4 components per pixel
+// universe, channel - E1.31 only: first universe and first DMX channel of the output
+// sequence - E1.31 only: E131_OUT_MAX_UNIVERSES sequence numbers, one per universe of the output (owned by the bus)
+// E1.31 frames end with e131OutSync(), which also sends the sync packet
 
 static       size_t sequenceNumber = 0; // this needs to be shared across all outputs
+#define ART_NET_PACKET_HEADER_LEN 18      // fixed part + sequence, physical, universe, length
+#define REALTIME_PACKET_MAX (DDP_HEADER_LEN + DDP_CHANNELS_PER_PACKET)
+
+// WLEDMM packets are assembled here (header + brightness-scaled payload) and sent with one write(); the socket is kept between frames
+static WiFiUDP realtimeUdp;
+static byte    realtimePacket[REALTIME_PACKET_MAX];
+
+// WLEDMM single pass copy with brightness scaling
+static void scaleChannels(byte *dst, const byte *src, size_t n, uint8_t bri) {
+  if (bri == 255) { memcpy(dst, src, n); return; }
+  for (size_t i = 0; i < n; i++) dst[i] = scale8(src[i], bri);
+}
+
+static bool sendRealtimePacket(IPAddress dest, uint16_t port, size_t len) {
+  if (!realtimeUdp.beginPacket(dest, port)) return false;
+  realtimeUdp.write(realtimePacket, len);
+  return realtimeUdp.endPacket();
+}
 static const size_t ART_NET_HEADER_SIZE = 12;
 static const byte   ART_NET_HEADER[] PROGMEM = {0x41,0x72,0x74,0x2d,0x4e,0x65,0x74,0x00,0x00,0x50,0x00,0x0e};
 
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW)  {
-  if (!(apActive || interfacesInited) || !client[0] || !length) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
+// WLEDMM E1.31 (sACN) output, packet layout as in ANSI E1.31-2018 (offsets from ESPAsyncE131.h)
+#define E131_OUT_SLOTS        512
+#define E131_SYNC_PACKET_LEN  49
+#define E131_VECTOR_ROOT_DATA 0x00000004
+#define E131_VECTOR_ROOT_EXT  0x00000008
+#define E131_VECTOR_FRAME_DATA 0x00000002
+#define E131_VECTOR_EXT_SYNC  0x00000001
+
+static uint8_t e131SyncSequence = 0;
+
+// WLEDMM per-frame state: the constant part of the data packet header, and the receivers that need a sync packet
+static byte      e131OutHeader[E131_DMP_DATA + 1];
+static bool      e131OutHeaderReady = false;
+static IPAddress e131OutSyncTargets[WLED_MAX_BUSSES];
+static uint8_t   e131OutSyncTargetCount = 0;
+
+static inline void e131Put16(byte *p, uint16_t v) { p[0] = v >> 8; p[1] = v & 0xFF; }
+static inline void e131Put32(byte *p, uint32_t v) { e131Put16(p, v >> 16); e131Put16(p + 2, v & 0xFFFF); }
+static inline void e131PutFlength(byte *p, size_t len) { e131Put16(p, 0x7000 | (len & 0x0FFF)); }
+
+// root layer (identical for data and sync packets), CID derived from our MAC address
+static void e131OutRootLayer(byte *pkt, size_t len, uint32_t vector) {
+  static const byte ACN_ID[12] PROGMEM = {0x41,0x53,0x43,0x2d,0x45,0x31,0x2e,0x31,0x37,0x00,0x00,0x00}; // "ASC-E1.17"
+  e131Put16(pkt + E131_ROOT_PREAMBLE_SIZE, 0x0010);
+  e131Put16(pkt + E131_ROOT_POSTAMBLE_SIZE, 0x0000);
+  memcpy_P(pkt + E131_ROOT_ID, ACN_ID, sizeof(ACN_ID));
+  e131PutFlength(pkt + E131_ROOT_FLENGTH, len - E131_ROOT_FLENGTH);
+  e131Put32(pkt + E131_ROOT_VECTOR, vector);
+  byte *cid = pkt + E131_ROOT_CID;
+  memcpy_P(cid, PSTR("WLED-MM-sACN"), 10); // 10 fixed bytes + 6 bytes MAC
+  WiFi.macAddress(cid + 10);
+}
+
+// header of a data packet without the per-universe fields (lengths, sequence, universe, slot count); built once per frame
+static void e131OutBuildHeader() {
+  byte *pkt = e131OutHeader;
+  e131OutRootLayer(pkt, sizeof(e131OutHeader), E131_VECTOR_ROOT_DATA);
+  // framing layer
+  e131Put32(pkt + E131_FRAME_VECTOR, E131_VECTOR_FRAME_DATA);
+  memset(pkt + E131_FRAME_SOURCE, 0, 64);
+  strlcpy((char*)pkt + E131_FRAME_SOURCE, serverDescription, 64);
+  pkt[E131_FRAME_PRIORITY] = e131OutPriority;
+  e131Put16(pkt + E131_FRAME_RESERVED, e131OutSyncUniverse);  // synchronization address
+  pkt[E131_FRAME_OPT] = 0;
+  // DMP layer
+  pkt[E131_DMP_VECTOR] = 0x02;
+  pkt[E131_DMP_TYPE] = 0xA1;
+  e131Put16(pkt + E131_DMP_ADDR_FIRST, 0x0000);
+  e131Put16(pkt + E131_DMP_ADDR_INC, 0x0001);
+  pkt[E131_DMP_DATA] = 0x00; // DMX start code
+  e131OutHeaderReady = true;
+}
+
+// data packet for one universe; the DMX slots must already be in place
+static size_t e131OutDataPacket(uint16_t universe, unsigned slots, uint8_t sequence) {
+  byte *pkt = realtimePacket;
+  const size_t len = E131_DMP_DATA + 1 + slots;
+  if (!e131OutHeaderReady) e131OutBuildHeader();
+  memcpy(pkt, e131OutHeader, sizeof(e131OutHeader));
+  e131PutFlength(pkt + E131_ROOT_FLENGTH, len - E131_ROOT_FLENGTH);
+  e131PutFlength(pkt + E131_FRAME_FLENGTH, len - E131_FRAME_FLENGTH);
+  e131PutFlength(pkt + E131_DMP_FLENGTH, len - E131_DMP_FLENGTH);
+  pkt[E131_FRAME_SEQ] = sequence;
+  e131Put16(pkt + E131_FRAME_UNIVERSE, universe);
+  e131Put16(pkt + E131_DMP_COUNT, slots + 1);
+  return len;
+}
 
-  WiFiUDP ddpUdp;
+static inline IPAddress e131OutDestination(IPAddress client, uint16_t universe) {
+  return e131OutMulticast ? IPAddress(239, 255, universe >> 8, universe & 0xFF) : client;
+}
+
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW, uint16_t universe, uint16_t channel, uint8_t *sequence)  {
+  if (!(apActive || interfacesInited) || !client[0] || !length) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
 
   switch (type) {
     case 0: // DDP
@@ -775,18 +872,13 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
       size_t packetCount = ((channelCount-1) / DDP_CHANNELS_PER_PACKET) +1;
 
       // there are 3 channels per RGB pixel
-      uint32_t channel = 0; // TODO: allow specifying the start channel
-      // the current position in the buffer
-      size_t bufferOffset = 0;
+      uint32_t offset = 0; // byte offset of this packet in the frame (not the E1.31 "channel" parameter) // TODO: allow specifying the start channel
 
+      realtimePacket[2] = isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24;
+      realtimePacket[3] = DDP_ID_DISPLAY;
       for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
         if (sequenceNumber > 15) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, DDP_DEFAULT_PORT)) {  // port defined in ESPAsyncE131.h
-          DEBUG_PRINTLN(F("DDP WiFiUDP.beginPacket returned an error"));
-          return 1; // problem
-        }
-
         // the amount of data is AFTER the header in the current packet
         size_t packetSize = DDP_CHANNELS_PER_PACKET;
 
@@ -800,40 +892,61 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
           }
         }
 
-        // write the header
-        /*0*/ddpUdp.write(flags);
-        /*1*/ddpUdp.write(sequenceNumber++ & 0x0F); // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
-        /*2*/ddpUdp.write(isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
-        /*3*/ddpUdp.write(DDP_ID_DISPLAY);
+        // header
+        realtimePacket[0] = flags;
+        realtimePacket[1] = sequenceNumber++ & 0x0F; // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
         // data offset in bytes, 32-bit number, MSB first
-        /*4*/ddpUdp.write(0xFF & (channel >> 24));
-        /*5*/ddpUdp.write(0xFF & (channel >> 16));
-        /*6*/ddpUdp.write(0xFF & (channel >>  8));
-        /*7*/ddpUdp.write(0xFF & (channel      ));
+        realtimePacket[4] = 0xFF & (offset >> 24);
+        realtimePacket[5] = 0xFF & (offset >> 16);
+        realtimePacket[6] = 0xFF & (offset >>  8);
+        realtimePacket[7] = 0xFF & (offset       );
         // data length in bytes, 16-bit number, MSB first
-        /*8*/ddpUdp.write(0xFF & (packetSize >> 8));
-        /*9*/ddpUdp.write(0xFF & (packetSize     ));
-
-        // write the colors, the write write(const uint8_t *buffer, size_t size)
-        // function is just a loop internally too
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        realtimePacket[8] = 0xFF & (packetSize >> 8);
+        realtimePacket[9] = 0xFF & (packetSize     );
+        scaleChannels(realtimePacket + DDP_HEADER_LEN, buffer + offset, packetSize, bri);
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("DDP WiFiUDP.endPacket returned an error"));
+        if (!sendRealtimePacket(client, DDP_DEFAULT_PORT, DDP_HEADER_LEN + packetSize)) {  // port defined in ESPAsyncE131.h
+          DEBUG_PRINTLN(F("DDP WiFiUDP packet could not be sent"));
           return 1; // problem
         }
 
-        channel += packetSize;
+        offset += packetSize;
       }
     } break;
 
     case 1: //E1.31
     {
+      // pixels are not split across universes: 170 RGB or 128 RGBW pixels per universe
+      static uint8_t noSequence[E131_OUT_MAX_UNIVERSES] = {0}; // for callers without their own counters
+      if (sequence == nullptr) sequence = noSequence;
+      const size_t channelsPerPixel = isRGBW ? 4 : 3;
+      const unsigned firstSlot = constrain(channel, 1, E131_OUT_SLOTS) - 1;
+      if (universe == 0) universe = 1;
+      size_t pixel = 0;
+
+      for (unsigned u = 0; (pixel < length) && (universe <= 63999) && (u < E131_OUT_MAX_UNIVERSES); u++, universe++) {
+        const unsigned slot0 = (u == 0) ? firstSlot : 0;
+        size_t pixels = (E131_OUT_SLOTS - slot0) / channelsPerPixel;
+        if (pixels == 0) continue; // start channel leaves no room for a pixel in the first universe
+        if (pixels > length - pixel) pixels = length - pixel;
+        const size_t count = pixels * channelsPerPixel;
+
+        byte *dmx = realtimePacket + E131_DMP_DATA + 1;
+        memset(dmx, 0, slot0);
+        scaleChannels(dmx + slot0, buffer + pixel * channelsPerPixel, count, bri);
+        const size_t packetLen = e131OutDataPacket(universe, slot0 + count, sequence[u]++);
+
+        if (!sendRealtimePacket(e131OutDestination(client, universe), E131_DEFAULT_PORT, packetLen)) {
+          DEBUG_PRINTLN(F("E1.31 WiFiUDP packet could not be sent"));
+          return 1; // problem
+        }
+        pixel += pixels;
+      }
+
+      // remember the receiver for the sync packet that e131OutSync() sends at the end of the frame
+      bool known = false;
+      for (unsigned t = 0; t < e131OutSyncTargetCount; t++) known |= (e131OutSyncTargets[t] == client);
+      if (!known && (e131OutSyncTargetCount < WLED_MAX_BUSSES)) e131OutSyncTargets[e131OutSyncTargetCount++] = client;
     } break;
 
     case 2: //ArtNet
@@ -843,20 +956,16 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
       const size_t ARTNET_CHANNELS_PER_PACKET = isRGBW?512:510; // 512/4=128 RGBW LEDs, 510/3=170 RGB LEDs
       const size_t packetCount = ((channelCount-1)/ARTNET_CHANNELS_PER_PACKET)+1;
 
-      uint32_t channel = 0; 
-      size_t bufferOffset = 0;
+      uint32_t offset = 0; // byte offset of this universe in the frame
 
       sequenceNumber++;
+      if (sequenceNumber > 255) sequenceNumber = 0;
+      memcpy_P(realtimePacket, ART_NET_HEADER, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
+      realtimePacket[12] = sequenceNumber & 0xFF; // sequence number. 1..255
+      realtimePacket[13] = 0x00;                  // physical - more an FYI, not really used for anything. 0..3
+      realtimePacket[15] = 0x00;                  // Universe MSB, unused.
 
       for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
-
-        if (sequenceNumber > 255) sequenceNumber = 0;
-
-        if (!ddpUdp.beginPacket(client, ARTNET_DEFAULT_PORT)) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.beginPacket returned an error"));
-          return 1; // borked
-        }
-
         size_t packetSize = ARTNET_CHANNELS_PER_PACKET;
 
         if (currentPacket == (packetCount - 1U)) {
@@ -866,30 +975,39 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
           }
         }
 
-        byte header_buffer[ART_NET_HEADER_SIZE];
-        memcpy_P(header_buffer, ART_NET_HEADER, ART_NET_HEADER_SIZE);
-        ddpUdp.write(header_buffer, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
-        ddpUdp.write(sequenceNumber & 0xFF); // sequence number. 1..255
-        ddpUdp.write(0x00); // physical - more an FYI, not really used for anything. 0..3
-        ddpUdp.write((currentPacket) & 0xFF); // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
-        ddpUdp.write(0x00); // Universe MSB, unused.
-        ddpUdp.write(0xFF & (packetSize >> 8)); // 16-bit length of channel data, MSB
-        ddpUdp.write(0xFF & (packetSize     )); // 16-bit length of channel data, LSB
-
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        realtimePacket[14] = (currentPacket) & 0xFF; // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
+        realtimePacket[16] = 0xFF & (packetSize >> 8); // 16-bit length of channel data, MSB
+        realtimePacket[17] = 0xFF & (packetSize     ); // 16-bit length of channel data, LSB
+        scaleChannels(realtimePacket + ART_NET_PACKET_HEADER_LEN, buffer + offset, packetSize, bri);
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.endPacket returned an error"));
+        if (!sendRealtimePacket(client, ARTNET_DEFAULT_PORT, ART_NET_PACKET_HEADER_LEN + packetSize)) {
+          DEBUG_PRINTLN(F("Art-Net WiFiUDP packet could not be sent"));
           return 1; // borked
         }
-        channel += packetSize;
+        offset += packetSize;
       }
     } break;
   }
   return 0;
 }
+
+// WLEDMM end of an E1.31 output frame: one sync packet tells the receivers to show all universes at once (multicast on the
+// sync universe, or to each unicast receiver of this frame). Called by BusManager::show() after all busses have sent.
+void e131OutSync() {
+  if (e131OutSyncUniverse && e131OutSyncTargetCount && (apActive || interfacesInited)) {
+    byte *sync = realtimePacket;
+    e131OutRootLayer(sync, E131_SYNC_PACKET_LEN, E131_VECTOR_ROOT_EXT);
+    e131PutFlength(sync + E131_FRAME_FLENGTH, E131_SYNC_PACKET_LEN - E131_FRAME_FLENGTH);
+    e131Put32(sync + E131_FRAME_VECTOR, E131_VECTOR_EXT_SYNC);
+    sync[44] = e131SyncSequence++;
+    e131Put16(sync + 45, e131OutSyncUniverse);
+    e131Put16(sync + 47, 0x0000); // reserved
+    const unsigned targets = e131OutMulticast ? 1 : e131OutSyncTargetCount;
+    for (unsigned t = 0; t < targets; t++) {
+      if (!sendRealtimePacket(e131OutDestination(e131OutSyncTargets[t], e131OutSyncUniverse), E131_DEFAULT_PORT, E131_SYNC_PACKET_LEN))
+        DEBUG_PRINTLN(F("E1.31 sync packet could not be sent"));
+    }
+  }
+  e131OutSyncTargetCount = 0;
+  e131OutHeaderReady = false; // settings and name changes apply from the next frame
+}
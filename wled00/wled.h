@@ -476,6 +476,10 @@ WLED_GLOBAL byte e131LastSequenceNumber[E131_MAX_UNIVERSE_COUNT]; // to detect p
 WLED_GLOBAL bool e131Multicast _INIT(false);                      // multicast or unicast
 WLED_GLOBAL bool e131SkipOutOfSequence _INIT(false);              // freeze instead of flickering
 WLED_GLOBAL uint16_t pollReplyCount _INIT(0);                     // count number of replies for ArtPoll node report
+// WLEDMM E1.31 (sACN) output of network busses
+WLED_GLOBAL byte e131OutPriority _INIT(100);                      // E1.31 priority of sent data (0..200)
+WLED_GLOBAL bool e131OutMulticast _INIT(false);                   // send to 239.255.<universe> instead of the bus IP
+WLED_GLOBAL uint16_t e131OutSyncUniverse _INIT(0);                // send E1.31 sync packets on this universe after each frame (0 = off)
 
 // mqtt
 WLED_GLOBAL unsigned long lastMqttReconnectAttempt _INIT(0);  // used for other periodic tasks too
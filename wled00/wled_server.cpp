@@ -59,6 +59,14 @@ void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t
     USER_PRINT(F("File uploaded: "));  // WLEDMM
     USER_PRINTLN(filename);            // WLEDMM
     invalidateFileNameCache();         // WLEDMM
+    if (filename.endsWith(".json")) {  // WLEDMM drop compiled jMap / ledmap, they get rebuilt from the new source
+      String binName = filename;
+      if (binName.charAt(0) != '/') binName = '/' + binName;
+      binName.replace(".json", ".jmap");
+      if (WLED_FS.exists(binName)) WLED_FS.remove(binName);
+      binName.replace(".jmap", ".lmap");
+      if (WLED_FS.exists(binName)) WLED_FS.remove(binName);
+    }
     if (filename.equalsIgnoreCase("/cfg.json") || filename.equalsIgnoreCase("cfg.json")) { // WLEDMM
       request->send(200, "text/plain", F("Configuration restore successful.\nRebooting..."));
       doReboot = true;
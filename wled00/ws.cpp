@@ -7,6 +7,11 @@
 
 static volatile uint16_t wsLiveClientId = 0;        // WLEDMM added "static"
 static volatile unsigned long wsLastLiveTime = 0;   // WLEDMM
+#ifdef WLEDMM_PROFILER
+static volatile uint16_t wsProfClientId = 0;        // WLEDMM client that requested the frame time stream ({"prof":true})
+static unsigned long wsLastProfTime = 0;
+#define WS_PROF_INTERVAL 1000
+#endif
 //uint8_t* wsFrameBuffer = nullptr;
 
 #if !defined(ARDUINO_ARCH_ESP32) || defined(WLEDMM_FASTPATH)   // WLEDMM
@@ -24,6 +29,9 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
   } else if(type == WS_EVT_DISCONNECT){
     //client disconnected
     if (client->id() == wsLiveClientId) wsLiveClientId = 0;
+    #ifdef WLEDMM_PROFILER
+    if (client->id() == wsProfClientId) wsProfClientId = 0;
+    #endif
     DEBUG_PRINTLN(F("WS client disconnected."));
   } else if(type == WS_EVT_DATA){
     DEBUG_PRINTLN(F("WS event data."));
@@ -57,6 +65,10 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
           verboseResponse = true;
         } else if (root.containsKey("lv")) {
           wsLiveClientId = root["lv"] ? client->id() : 0;
+        #ifdef WLEDMM_PROFILER
+        } else if (root.containsKey("prof")) {
+          wsProfClientId = root["prof"] ? client->id() : 0;
+        #endif
         } else {
           verboseResponse = deserializeState(root);
         }
@@ -183,6 +195,7 @@ void sendDataWs(AsyncWebSocketClient * client)
   releaseJSONBufferLock();
 }
 
+#ifndef WLEDMM_BUS_BUFFER
 // WLEDMM function to recover full-bright pixel (based on code from upstream alt-buffer, which is based on code from NeoPixelBrightnessBus)
 static uint32_t restoreColorLossy(uint32_t c, uint_fast8_t _restaurationBri) {
   if (_restaurationBri == 255) return c;
@@ -194,6 +207,7 @@ static uint32_t restoreColorLossy(uint32_t c, uint_fast8_t _restaurationBri) {
   }
   return c;
 }
+#endif
 
 static bool sendLiveLedsWs(uint32_t wsClient)  // WLEDMM added "static"
 {
@@ -225,7 +239,9 @@ static bool sendLiveLedsWs(uint32_t wsClient)  // WLEDMM added "static"
     used = strip.getLengthTotal();
     n = ((used -1)/MAX_LIVE_LEDS_WS) +1; //only serve every n'th LED if count over MAX_LIVE_LEDS_WS
   #endif
-  size_t pos = (strip.isMatrix ? 4 : 2);
+  // WLEDMM version 3 header carries 16 bit width/height, used only when the (scaled) matrix does not fit into version 2
+  const bool wideHeader = strip.isMatrix && ((Segment::maxWidth/n > 255) || (Segment::maxHeight/n > 255));
+  size_t pos = (strip.isMatrix ? (wideHeader ? 6 : 4) : 2);
   size_t bufSize = pos + (used/n)*3;
 
   if ((bufSize < 1) || (used < 1)) return(false); // WLEDMM should not happen
@@ -257,14 +273,24 @@ static bool sendLiveLedsWs(uint32_t wsClient)  // WLEDMM added "static"
   buffer[1] = 1; //version
   #ifndef WLED_DISABLE_2D
     if (strip.isMatrix) {
-      buffer[1] = 2; //version
       //WLEDMM skipping lines done right 
-      buffer[2] = MIN(Segment::maxWidth/n, (uint16_t) 255); // WLEDMM prevent overflow on buffer type uint8_t
-      buffer[3] = MIN(Segment::maxHeight/n, (uint16_t) 255);
+      uint16_t w = Segment::maxWidth/n;
+      uint16_t h = Segment::maxHeight/n;
+      if (wideHeader) {
+        buffer[1] = 3; //version: 16 bit big-endian width & height
+        buffer[2] = w >> 8; buffer[3] = w & 0xFF;
+        buffer[4] = h >> 8; buffer[5] = h & 0xFF;
+      } else {
+        buffer[1] = 2; //version
+        buffer[2] = w;
+        buffer[3] = h;
+      }
     }
   #endif
 
+#ifndef WLEDMM_BUS_BUFFER
   uint8_t stripBrightness = strip.getBrightness();
+#endif
   for (size_t i = 0; pos < bufSize -2; i += n)
   {
   //WLEDMM skipping lines done right 
@@ -273,7 +299,11 @@ static bool sendLiveLedsWs(uint32_t wsClient)  // WLEDMM added "static"
       if ((i/Segment::maxWidth)%(n)) i += Segment::maxWidth * (n-1);
     }
   #endif
+#ifdef WLEDMM_BUS_BUFFER
+    uint32_t c = strip.getPixelColor(i); // WLEDMM bus buffers hold full bright colors
+#else
     uint32_t c = restoreColorLossy(strip.getPixelColor(i), stripBrightness); // WLEDMM full bright preview - does _not_ recover ABL reductions
+#endif
     // WLEDMM begin: preview with color gamma correction
     if (gammaCorrectPreview) {
       uint8_t w = W(c);  // not sure why, but it looks better if using "white" without corrections
@@ -296,6 +326,28 @@ static bool sendLiveLedsWs(uint32_t wsClient)  // WLEDMM added "static"
   return true;
 }
 
+#ifdef WLEDMM_PROFILER
+// WLEDMM send frame time statistics as {"prof":{...}} to the client that requested them
+static void sendProfileWs(uint32_t wsClient)
+{
+  AsyncWebSocketClient * wsc = ws.client(wsClient);
+  if (!wsc) { wsProfClientId = 0; return; }
+  if (wsc->queueLength() > 0 || jsonBufferLock) return; // try again next time, never wait in the main loop
+  if (!requestJSONBufferLock(24)) return;
+  serializeProfile(doc.createNestedObject(F("prof")));
+  size_t len = measureJson(doc);
+  AsyncWebSocketMessageBuffer * buffer = (len > 0) ? ws.makeBuffer(len) : nullptr;
+  if (buffer) {
+    buffer->lock();
+    serializeJson(doc, (char *)buffer->get(), len);
+    wsc->text(buffer);
+    buffer->unlock();
+    ws._cleanBuffers();
+  }
+  releaseJSONBufferLock();
+}
+#endif
+
 void handleWs()
 {
   if ((millis() - wsLastLiveTime) > (unsigned long)(max((strip.getLengthTotal()/20), WS_LIVE_INTERVAL))) //WLEDMM dynamic nr of peek frames per second
@@ -310,6 +362,12 @@ void handleWs()
     wsLastLiveTime = millis();
     if (!success) wsLastLiveTime -= 20; //try again in 20ms if failed due to non-empty WS queue
   }
+  #ifdef WLEDMM_PROFILER
+  if (wsProfClientId && (millis() - wsLastProfTime > WS_PROF_INTERVAL)) {
+    sendProfileWs(wsProfClientId);
+    wsLastProfTime = millis();
+  }
+  #endif
 }
 
 #else
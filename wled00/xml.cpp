@@ -435,6 +435,8 @@ void getSettingsJS(AsyncWebServerRequest* request, byte subPage, char* dest) //W
       char aw[4] = "AW"; aw[2] = 48+s; aw[3] = 0; //auto white mode
       char wo[4] = "WO"; wo[2] = 48+s; wo[3] = 0; //swap channels
       char sp[4] = "SP"; sp[2] = 48+s; sp[3] = 0; //bus clock speed
+      char eu[4] = "EU"; eu[2] = 48+s; eu[3] = 0; //E1.31 start universe
+      char ea[4] = "EA"; ea[2] = 48+s; ea[3] = 0; //E1.31 start channel
       oappend(SET_F("addLEDs(1);"));
       uint8_t pins[5];
       uint8_t nPins = bus->getPins(pins);
@@ -472,6 +474,10 @@ void getSettingsJS(AsyncWebServerRequest* request, byte subPage, char* dest) //W
         }
       }
       sappend('v',sp,speed);
+      if (bus->getUniverse()) { // WLEDMM E1.31 network bus
+        sappend('v',eu,bus->getUniverse());
+        sappend('v',ea,bus->getStartChannel());
+      }
 
       oappend(SET_F("setPixelLimit("));
       oappendi(s); oappend(SET_F(","));
@@ -596,6 +602,9 @@ void getSettingsJS(AsyncWebServerRequest* request, byte subPage, char* dest) //W
     sappend('v',SET_F("XX"),DMXSegmentSpacing);
     sappend('v',SET_F("PY"),e131Priority);
     sappend('v',SET_F("DM"),DMXMode);
+    sappend('v',SET_F("EOP"),e131OutPriority);
+    sappend('c',SET_F("EOM"),e131OutMulticast);
+    sappend('v',SET_F("EOS"),e131OutSyncUniverse);
     sappend('v',SET_F("ET"),realtimeTimeoutMs);
     sappend('c',SET_F("FB"),arlsForceMaxBri);
     sappend('c',SET_F("RG"),arlsDisableGammaCorrection);